@@ -1,5 +1,9 @@
 #include "internal.hpp"
 
+#ifndef __WIN32
+#include <sys/mman.h>
+#endif
+
 namespace CaDiCaL {
 
 Arena::Arena (Internal * i) {
@@ -8,23 +12,75 @@ Arena::Arena (Internal * i) {
 }
 
 Arena::~Arena () {
-  delete [] from.start;
-  delete [] to.start;
+  release (from.start, from.mapped);
+  release (to.start, to.mapped);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Transparent huge pages are only used for regions aligned to their size.
+// Thus we map one huge page more than needed and unmap the unaligned
+// prefix and the remaining suffix.
+
+char * Arena::allocate (size_t bytes, size_t & mapped) {
+  mapped = 0;
+#ifndef __WIN32
+  const size_t huge = (size_t) 1 << 21;
+  if (internal->opts.arenammap && bytes >= huge) {
+    const size_t size = (bytes + huge - 1) & ~(huge - 1);
+    void * p = mmap (0, size + huge, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      char * start = (char *) p;
+      const uintptr_t mask = huge - 1;
+      char * aligned = (char *) (((uintptr_t) start + mask) & ~mask);
+      if (aligned > start) munmap (start, aligned - start);
+      char * end = aligned + size;
+      const size_t suffix = (start + size + huge) - end;
+      if (suffix) munmap (end, suffix);
+#ifdef MADV_HUGEPAGE
+      madvise (aligned, size, MADV_HUGEPAGE);
+#endif
+      LOG ("mapped %zd bytes of arena at %p", size, (void *) aligned);
+      mapped = size;
+      return aligned;
+    }
+    LOG ("mapping %zd bytes of arena failed", size);
+  }
+#endif
+  return new char[bytes];
+}
+
+void Arena::release (char * start, size_t mapped) {
+#ifndef __WIN32
+  if (mapped) {
+    LOG ("unmapping %zd bytes of arena at %p", mapped, (void *) start);
+    munmap (start, mapped);
+    return;
+  }
+#else
+  assert (!mapped);
+  (void) mapped;
+#endif
+  delete [] start;
 }
 
+/*------------------------------------------------------------------------*/
+
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  to.top = to.start = allocate (bytes, to.mapped);
   to.end = to.start + bytes;
 }
 
 void Arena::swap () {
-  delete [] from.start;
+  release (from.start, from.mapped);
   LOG ("delete 'from' space of arena with %zd bytes",
     (size_t) (from.end - from.start));
   from = to;
   to.start = to.top = to.end = 0;
+  to.mapped = 0;
 }
 
 }
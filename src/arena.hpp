@@ -28,6 +28,15 @@ namespace CaDiCaL {
 // compared by varying the 'opts.arenatype' option (which also controls the
 // allocation order of clauses during moving them).
 
+// Thus the heap allocated clauses outside of the arena form a 'nursery' of
+// young clauses, while the arena holds 'tenured' clauses which survived at
+// least one moving garbage collection.  Most garbage consists of young
+// learned clauses removed by 'reduce'.  These can be deleted without moving
+// any clause, while deleted clauses in the arena only leave unused space.
+// The arena is only compacted by moving all clauses if either its unused
+// space or the surviving young clauses exceed 'opts.arenaminor' percent
+// (see 'moving_garbage_collection' in 'collect.cpp').
+
 // The standard sequence of using the arena is as follows:
 //
 //   Arena arena;
@@ -51,13 +60,26 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// Large spaces (at least 2 MB) are mapped directly with 'mmap' (unless
+// 'opts.arenammap' is disabled or on Windows) and advised to be backed by
+// transparent huge pages, which reduces TLB misses when propagating over
+// clauses in the arena.  Deleting such a space unmaps it and thus returns
+// its memory to the operating system immediately, while memory freed to
+// the heap usually is not returned, even if the arena shrinks a lot.
+
 struct Internal;
 
 class Arena {
 
   Internal * internal;
 
-  struct { char * start, * top, * end; } from, to;
+  struct {
+    char * start, * top, * end;
+    size_t mapped;              // size of mapping or zero if on heap
+  } from, to;
+
+  char * allocate (size_t bytes, size_t & mapped);
+  void release (char * start, size_t mapped);
 
 public:
 
@@ -78,6 +100,19 @@ public:
     return from.start <= c && c < from.top;
   }
 
+  // Number of bytes allocated in 'from' space (including those of clauses
+  // deleted since the last 'swap', which are not reclaimed before).
+  //
+  size_t size () const { return from.top - from.start; }
+
+  // Allocated bytes of both spaces (including alignment of mappings).
+  //
+  size_t capacity () const {
+    size_t res = from.mapped ? from.mapped : from.end - from.start;
+    res += to.mapped ? to.mapped : to.end - to.start;
+    return res;
+  }
+
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
   // space has been prepared to hold enough memory with 'prepare'.  Then
   // copy the memory pointed to by 'p' of size 'bytes'.  Note that it does
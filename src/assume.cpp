@@ -205,6 +205,37 @@ bool Internal::failed (int lit) {
   return (f.failed & bit) != 0;
 }
 
+// In incremental usage with many 'solve' calls sharing a long prefix of
+// assumptions, as for instance in bounded model checking, most of the time
+// can be spent in deciding and propagating the same assumptions again.
+// Thus instead of backtracking to the root level at the start of 'solve'
+// we keep those decision levels of the previous trail which assign the
+// same assumptions in the same order.  This includes pseudo decision
+// levels of assumptions, which are still implied by the lower levels.
+// Adding clauses, new variables or a constraint backtracks to the root
+// level, so the kept levels are still conflict free and propagated.
+
+int Internal::reuse_assumption_levels () {
+  if (!opts.assumereusetrail) return 0;
+  const int size = assumptions.size ();
+  const int max_level = min (level, size);
+  int res = 0;
+  while (res < max_level) {
+    const int lit = assumptions[res];
+    const int decision = control[res + 1].decision;
+    if (decision) {
+      if (decision != lit) break;
+    } else if (val (lit) <= 0 || var (lit).level > res) break;
+    res++;
+  }
+  LOG ("reusing %d assumption levels out of %d", res, level);
+  if (res) {
+    stats.reusedassume++;
+    stats.reusedalevels += res;
+  }
+  return res;
+}
+
 // Add the start of each incremental phase (leaving the state
 // 'UNSATISFIABLE' actually) we reset all assumptions.
 
@@ -0,0 +1,140 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Backbone computation by iterative model-guided filtering of candidates
+// as in 'Algorithms for Computing Backbones of Propositional Formulae' by
+// Janota, Lynce and Marques-Silva [AICOM'15].  Starting with the literals
+// satisfied by the first model as candidates, the solver is called with
+// the negation of a chunk of 'backbonechunk' candidates as constraint.  If
+// this call is satisfiable all candidates falsified by the new model are
+// dropped, which includes at least one literal of the chunk.  Otherwise
+// all the literals in the chunk are backbone literals.
+//
+// Without assumptions such an unsatisfiable call actually means that all
+// literals of the constraint are falsified on the root-level, since the
+// constraint is only checked after all assumptions are assigned.  Thus
+// the backbone literals are learned as units by the solver on-the-fly and
+// are used in all later calls.  Before each call we further take all
+// candidates which became root-level fixed through propagation of such
+// units (or units learned otherwise) as backbone literals without
+// checking them explicitly.
+
+/*------------------------------------------------------------------------*/
+
+// Later calls assume the same assumptions as the first call but do not
+// reset limits, in contrast to 'solve'.  The internal assumptions are
+// reset and assumed again to clear failed assumption flags.  Since the
+// first call resets the limits, the user limits are saved before and
+// applied again by 'backbone_limits' before each later call.
+
+static void backbone_limits (Internal * internal,
+                             const Inc & inc, int terminate) {
+  internal->limit_terminate (terminate);
+  internal->limit_conflicts ((int) inc.conflicts);
+  internal->limit_decisions ((int) inc.decisions);
+  internal->limit_preprocessing ((int) inc.preprocessing);
+  internal->limit_local_search ((int) inc.localsearch);
+  internal->limit_memory ((int) inc.memory);
+}
+
+int External::backbone_solve () {
+  internal->reset_assumptions ();
+  for (const auto & elit : assumptions)
+    internal->assume (internalize (elit));
+  assume_groups ();
+  reset_extended ();
+  int res = internal->solve (false);
+  check_solve_result (res);
+  return res;
+}
+
+// Move root-level fixed candidates to the backbone and remove candidates
+// falsified by the current model (if 'filter' is true).
+
+void External::backbone_filter (vector<int> & candidates,
+                                vector<int> & lits, bool filter) {
+  Stats & stats = internal->stats;
+  if (filter && !extended) extend ();
+  const auto end = candidates.end ();
+  auto j = candidates.begin ();
+  for (auto i = j; i != end; i++) {
+    const int elit = *i;
+    if (fixed (elit) > 0) {
+      LOG ("backbone literal %d root-level fixed", elit);
+      stats.backbone.fixed++;
+      lits.push_back (elit);
+    } else if (filter && ival (elit) < 0) {
+      LOG ("backbone candidate %d falsified by model", elit);
+      stats.backbone.filtered++;
+    } else *j++ = elit;
+  }
+  candidates.resize (j - candidates.begin ());
+}
+
+int External::backbone (vector<int> & lits) {
+
+  Stats & stats = internal->stats;
+  stats.backbone.count++;
+  int64_t calls = 0;
+
+  lits.clear ();
+
+  const Inc limits = internal->inc;
+  const int terminate = internal->lim.terminate.forced;
+
+  int res = solve (false);
+  if (res != 10) return res;
+
+  // Hidden variables and group variables are not user variables.
+
+  vector<int> candidates;
+  if (!extended) extend ();
+  for (auto idx : vars)
+    if (!hidden (idx) && !group_var (idx))
+      candidates.push_back (ival (idx));
+
+  const size_t chunk = internal->opts.backbonechunk;
+  backbone_filter (candidates, lits, false);
+
+  while (!candidates.empty ()) {
+
+    const size_t size = min (chunk, candidates.size ());
+    for (size_t i = 0; i < size; i++)
+      constrain (-candidates[i]);
+    constrain (0);
+
+    LOG ("checking %zd backbone candidates out of %zd", size,
+      candidates.size ());
+
+    stats.backbone.calls++;
+    calls++;
+    backbone_limits (internal, limits, terminate);
+    res = backbone_solve ();
+    reset_constraint ();
+
+    if (res == 20) {
+      LOG ("found %zd backbone literals", size);
+      for (size_t i = 0; i < size; i++)
+        lits.push_back (candidates[i]);
+      candidates.erase (candidates.begin (), candidates.begin () + size);
+      stats.backbone.checked += size;
+      backbone_filter (candidates, lits, false);
+      res = 10;
+    } else if (res == 10) backbone_filter (candidates, lits, true);
+    else break;
+  }
+
+  sort (lits.begin (), lits.end (),
+    [] (int a, int b) { return abs (a) < abs (b); });
+  reset_limits ();
+
+  VERBOSE (2, "found %zd backbone literals in %" PRId64 " calls",
+    lits.size (), calls);
+
+  return res;
+}
+
+}
@@ -3,9 +3,10 @@
 namespace CaDiCaL {
 
 // The global assignment stack can only be (partially) reset through
-// 'backtrack' which is the only function using 'unassign' (inlined and thus
-// local to this file).  It turns out that 'unassign' does not need a
-// specialization for 'probe' nor 'vivify' and thus it is shared.
+// 'backtrack' and 'probe_backtrack' which are the only functions using
+// 'unassign' (inlined and thus local to this file).  It turns out that
+// 'unassign' does not need a specialization for 'probe' nor 'vivify' and
+// thus it is shared.
 
 inline void Internal::unassign (int lit) {
   assert (val (lit) > 0);
@@ -82,6 +83,8 @@ void Internal::backtrack (int new_level) {
   LOG ("backtracking to decision level %d with decision %d and trail %zd",
     new_level, control[new_level].decision, assigned);
 
+  if (cards.propagated > assigned) card_backtrack (assigned);
+
   const size_t end_of_trail = trail.size ();
   size_t i = assigned, j = i;
 
@@ -117,9 +120,36 @@ void Internal::backtrack (int new_level) {
   if (propagated > assigned) propagated = assigned;
   if (propagated2 > assigned) propagated2 = assigned;
   if (no_conflict_until > assigned) no_conflict_until = assigned;
+  if (notified > assigned) notified = assigned;
+
+  if (notified_level > new_level) {
+    notified_level = new_level;
+    if (external->propagator)
+      external->propagator->notify_backtrack ((size_t) new_level);
+  }
 
   control.resize (new_level + 1);
   level = new_level;
 }
 
+/*------------------------------------------------------------------------*/
+
+// Tree based probing in 'probe.cpp' backtracks within decision level one
+// to the trail of the parent of a probed literal.  All the literals before
+// 'assigned' are propagated already.
+
+void Internal::probe_backtrack (size_t assigned) {
+  require_mode (PROBE);
+  assert (level == 1);
+  assert ((size_t) control[1].trail < assigned);
+  assert (assigned <= trail.size ());
+  LOG ("probe backtracking to trail %zd", assigned);
+  while (trail.size () > assigned) {
+    unassign (trail.back ());
+    trail.pop_back ();
+  }
+  propagated = propagated2 = assigned;
+  if (notified > assigned) notified = assigned;
+}
+
 }
@@ -9,14 +9,58 @@ namespace CaDiCaL {
 void Internal::init_bins () {
   assert (big.empty ());
   if (big.size () < 2*vsize)
-    big.resize (2*vsize, Bins ());
+    big.resize (2*vsize, Bins (PoolAllocator<int> (&pool)));
   LOG ("initialized binary implication graph");
 }
 
 void Internal::reset_bins () {
   assert (!big.empty ());
   erase_vector (big);
+  pool.release ();
   LOG ("reset binary implication graph");
 }
 
+/*------------------------------------------------------------------------*/
+
+// Build the compressed sparse row snapshot of the binary implication graph
+// of all non-garbage binary clauses (only irredundant ones unless
+// 'redundant' is true).  The first pass counts the out-degree of each
+// literal, which after computing prefix sums gives the offsets, and the
+// second pass fills in the edges from the end of each literal's range.
+
+void Internal::init_bin_graph (BinGraph & g, bool redundant) {
+
+  const size_t size = 2*vsize;
+  g.offsets.assign (size + 1, 0);
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->size != 2) continue;
+    if (c->redundant && !redundant) continue;
+    g.offsets[vlit (-c->literals[0])]++;
+    g.offsets[vlit (-c->literals[1])]++;
+  }
+
+  size_t sum = 0;
+  for (size_t u = 0; u <= size; u++)
+    sum = (g.offsets[u] += sum);
+
+  g.targets.resize (sum);
+  g.reasons.resize (sum);
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->size != 2) continue;
+    if (c->redundant && !redundant) continue;
+    for (int i = 0; i < 2; i++) {
+      const int lit = c->literals[i], other = c->literals[!i];
+      const size_t pos = --g.offsets[vlit (-lit)];
+      g.targets[pos] = other;
+      g.reasons[pos] = c;
+    }
+  }
+
+  LOG ("initialized binary implication graph with %zd edges", sum);
+}
+
 }
@@ -1,17 +1,45 @@
 #ifndef _bins_hpp_INCLUDED
 #define _bins_hpp_INCLUDED
 
+#include "pool.hpp"     // Alphabetically after 'bins'.
 #include "util.hpp"     // Alphabetically after 'bins'.
 
 namespace CaDiCaL {
 
 using namespace std;
 
-typedef vector<int> Bins;
+struct Clause;
+
+typedef vector<int, PoolAllocator<int> > Bins;
 
 inline void shrink_bins (Bins & bs) { shrink_vector (bs); }
 inline void erase_bins (Bins & bs) { erase_vector (bs); }
 
+// Snapshot of the binary implication graph in compressed sparse row form.
+// The literals implied by a literal with 'vlit' index 'u' are stored in
+// 'targets' from 'offsets[u]' to 'offsets[u+1]' (exclusive) together with
+// the binary clauses of these edges in 'reasons' at the same positions.
+// Thus the whole graph consists of three flat arrays built in one linear
+// pass over the clauses instead of one heap allocated vector per literal.
+// Since the snapshot is not updated, users have to check whether the
+// clause of an edge has become garbage in the mean time if necessary.
+
+struct BinGraph {
+  vector<size_t> offsets;       // start of edges of each literal
+  vector<int> targets;          // implied literals
+  vector<Clause *> reasons;     // binary clauses of the edges
+
+  size_t begin (unsigned u) const { return offsets[u]; }
+  size_t end (unsigned u) const { return offsets[u + 1]; }
+  size_t degree (unsigned u) const { return end (u) - begin (u); }
+};
+
+inline void erase_bin_graph (BinGraph & g) {
+  erase_vector (g.offsets);
+  erase_vector (g.targets);
+  erase_vector (g.reasons);
+}
+
 }
 
 #endif
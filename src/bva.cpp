@@ -0,0 +1,356 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Bounded variable addition following 'Automated Reencoding of Boolean
+// Formulas' by Manthey, Heule and Biere [HVC'12].  If the formula contains
+// all the clauses 'l_i | C_j' for a set of literals 'l_1, ..., l_n' and a
+// set of (sub)clauses 'C_1, ..., C_m', then these 'n * m' clauses can be
+// replaced by the 'n + m' clauses 'l_i | x' and '-x | C_j' where 'x' is a
+// new variable.  Resolving on 'x' gives back the original clauses, thus the
+// result is a conservative extension of the original formula.  This also
+// means that any model of the original formula can be extended to a model
+// of the new one and is the reason why it is fine to use bounded variable
+// addition in incremental solving without treating frozen literals
+// specially.  Typical examples are pairwise at-most-one constraints, which
+// are turned into a product like encoding.
+//
+// The new variables are added as hidden external variables (see
+// 'External::new_hidden_var').  Thus they can later be eliminated and
+// end up on the extension stack like any other variable.  We do not know
+// how to trace the addition in the internal proof checker and thus skip
+// bounded variable addition if proofs are traced or checked.
+
+/*------------------------------------------------------------------------*/
+
+inline bool bva_less_noccs::operator () (unsigned a, unsigned b) {
+  const int64_t s = internal->noccs (internal->u2i (a));
+  const int64_t t = internal->noccs (internal->u2i (b));
+  if (s < t) return true;
+  if (s > t) return false;
+  return a > b;
+}
+
+/*------------------------------------------------------------------------*/
+
+// The literal of 'c' except 'lit' with the smallest number of occurrences.
+
+int Internal::bva_least_occurring_literal (Clause * c, int lit) {
+  int res = 0;
+  int64_t min_noccs = 0;
+  for (const auto & other : *c) {
+    if (other == lit) continue;
+    const int64_t tmp = noccs (other);
+    if (res && tmp >= min_noccs) continue;
+    min_noccs = tmp;
+    res = other;
+  }
+  assert (res);
+  return res;
+}
+
+// Find the clause which is the same as 'c' except that 'lit' is replaced
+// by 'other'.  Assumes that all literals of 'c' except 'lit' are marked.
+
+Clause *
+Internal::bva_find_matching_clause (Clause * c, int lit, int other) {
+  const int min_lit = bva_least_occurring_literal (c, lit);
+  for (const auto & d : occs (min_lit)) {
+    if (d == c) continue;
+    if (d->garbage) continue;
+    if (d->size != c->size) continue;
+    bool found = false, match = true;
+    for (const auto & tmp : *d) {
+      if (marked (tmp) > 0) continue;
+      if (tmp != other) { match = false; break; }
+      found = true;
+    }
+    if (match && found) return d;
+  }
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Update occurrence counters and the schedule for added (from 'clause')
+// and removed clauses.  Literals in new clauses are (re)scheduled.
+
+void Internal::bva_add_clause (BVASchedule & schedule) {
+  Clause * c = new_clause (false);
+  clause.clear ();
+  LOG (c, "bva added");
+  stats.bva.added++;
+  for (const auto & lit : *c) {
+    occs (lit).push_back (c);
+    noccs (lit)++;
+    const unsigned u = vlit (lit);
+    if (schedule.contains (u)) schedule.update (u);
+    else schedule.push_back (u);
+  }
+}
+
+void Internal::bva_remove_clause (BVASchedule & schedule, Clause * c) {
+  LOG (c, "bva removing");
+  mark_garbage (c);
+  stats.bva.removed++;
+  for (const auto & lit : *c) {
+    assert (noccs (lit) > 0);
+    noccs (lit)--;
+    const unsigned u = vlit (lit);
+    if (schedule.contains (u)) schedule.update (u);
+  }
+}
+
+// Replace all 'lits.size () * matched.size ()' matched clauses.  The
+// clauses in 'matched' are those containing 'lit' and the other matched
+// clauses are found again with 'bva_find_matching_clause'.
+
+void Internal::bva_replace (BVASchedule & schedule, int lit,
+                            const vector<int> & lits,
+                            const vector<Clause *> & matched) {
+
+  // Adding a variable might enlarge all tables including the watches,
+  // which we are not using here, while the occurrence tables are not.
+
+  const int idx = external->new_hidden_var ();
+  if (watching ()) reset_watches ();
+  init_occs ();
+  if (ntab.size () < 2*vsize) ntab.resize (2*vsize, 0);
+  stats.bva.vars++;
+
+  LOG (lits, "bva on %d with %zd clauses introduces %d for",
+    lit, matched.size (), idx);
+
+  for (const auto & other : lits) {
+    assert (clause.empty ());
+    clause.push_back (other);
+    clause.push_back (idx);
+    bva_add_clause (schedule);
+  }
+
+  for (const auto & c : matched) {
+    assert (clause.empty ());
+    clause.push_back (-idx);
+    for (const auto & other : *c)
+      if (other != lit) clause.push_back (other);
+    bva_add_clause (schedule);
+  }
+
+  for (const auto & c : matched) {
+    for (const auto & other : *c)
+      if (other != lit) mark (other);
+    for (const auto & other : lits) {
+      if (other == lit) continue;
+      // If 'c' has a duplicate in 'matched' the matching clause might have
+      // been removed already for that duplicate.
+      //
+      Clause * d = bva_find_matching_clause (c, lit, other);
+      if (d) bva_remove_clause (schedule, d);
+    }
+    for (const auto & other : *c)
+      if (other != lit) unmark (other);
+    bva_remove_clause (schedule, c);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Greedily extend the set of matched literals starting with 'lit' and all
+// its clauses.  In each step the literal 'other' which occurs in most
+// clauses obtained by replacing 'lit' in the matched clauses is added, as
+// long as the reduction in the number of clauses increases.
+
+void Internal::bva_lit (BVASchedule & schedule, int lit,
+                        int64_t & ticks, int64_t limit) {
+
+  vector<int> lits;
+  vector<Clause *> matched;
+
+  lits.push_back (lit);
+  for (const auto & c : occs (lit))
+    if (!c->garbage) matched.push_back (c);
+
+  vector<pair<int, size_t>> pairs;
+
+  for (;;) {
+
+    pairs.clear ();
+
+    for (size_t i = 0; i < matched.size (); i++) {
+      Clause * c = matched[i];
+      const int min_lit = bva_least_occurring_literal (c, lit);
+      for (const auto & other : *c)
+        if (other != lit) mark (other);
+      for (const auto & d : occs (min_lit)) {
+        ticks++;
+        if (d == c) continue;
+        if (d->garbage) continue;
+        if (d->size != c->size) continue;
+        int unmarked = 0;
+        bool match = true;
+        for (const auto & other : *d) {
+          if (marked (other) > 0) continue;
+          if (unmarked) { match = false; break; }
+          unmarked = other;
+        }
+        if (!match || !unmarked) continue;
+        if (unmarked == lit || unmarked == -lit) continue;
+        if (find (lits.begin (), lits.end (), unmarked) != lits.end ())
+          continue;
+        pairs.push_back (make_pair (unmarked, i));
+      }
+      for (const auto & other : *c)
+        if (other != lit) unmark (other);
+      if (ticks > limit) return;
+    }
+
+    if (pairs.empty ()) break;
+
+    // Find the literal with the most matched clauses.  Duplicated clauses
+    // might produce the same pair twice, which is counted only once.
+
+    sort (pairs.begin (), pairs.end ());
+
+    int best = 0;
+    int64_t best_count = 0;
+
+    const auto end = pairs.end ();
+    auto p = pairs.begin ();
+    while (p != end) {
+      const int other = p->first;
+      int64_t count = 0;
+      size_t prev = matched.size ();
+      for (; p != end && p->first == other; p++)
+        if (p->second != prev) prev = p->second, count++;
+      if (count <= best_count) continue;
+      best_count = count;
+      best = other;
+    }
+    assert (best);
+
+    const int64_t a = lits.size (), b = matched.size ();
+    const int64_t current = a * b - a - b;
+    const int64_t next = (a + 1) * best_count - (a + 1) - best_count;
+    if (next <= current) break;
+
+    LOG ("bva on %d adds %d matching %" PRId64 " clauses",
+      lit, best, best_count);
+
+    lits.push_back (best);
+
+    vector<Clause *> filtered;
+    size_t prev = matched.size ();
+    for (const auto & q : pairs)
+      if (q.first == best && q.second != prev)
+        filtered.push_back (matched[q.second]), prev = q.second;
+    matched.swap (filtered);
+  }
+
+  const int64_t a = lits.size (), b = matched.size ();
+  if (a < 2 || a * b - a - b <= 0) return;
+
+  bva_replace (schedule, lit, lits, matched);
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::bva () {
+
+  if (!opts.bva) return;
+  if (unsat) return;
+  if (terminated_asynchronously ()) return;
+  if (proof) return;
+  if (external->solution) return;
+  if (!stats.current.irredundant) return;
+
+  assert (!level);
+
+  if (propagated < trail.size () && !propagate ()) {
+    LOG ("propagating units results in empty clause");
+    learn_empty_clause ();
+    return;
+  }
+
+  if (last.collect.fixed < stats.all.fixed) garbage_collection ();
+
+  START_SIMPLIFIER (bva, BVA);
+  stats.bva.count++;
+
+  int64_t limit = stats.propagations.search;
+  limit *= 1e-3 * opts.bvareleff;
+  if (limit < opts.bvamineff) limit = opts.bvamineff;
+  if (limit > opts.bvamaxeff) limit = opts.bvamaxeff;
+
+  PHASE ("bva", stats.bva.count,
+    "bounded variable addition limited to %" PRId64 " ticks", limit);
+
+  reset_watches ();
+  init_occs ();
+  init_noccs ();
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->redundant) continue;
+    if (c->size > opts.bvaclslim) continue;
+    for (const auto & lit : *c) {
+      occs (lit).push_back (c);
+      noccs (lit)++;
+    }
+  }
+
+  BVASchedule schedule (this);
+  for (auto idx : vars) {
+    if (!active (idx)) continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (noccs (lit) > 1) schedule.push_back (vlit (lit));
+    }
+  }
+
+  const int64_t old_vars = stats.bva.vars;
+#ifndef QUIET
+  const int64_t old_removed = stats.bva.removed;
+  const int64_t old_added = stats.bva.added;
+#endif
+
+  int64_t ticks = 0;
+  while (!terminated_asynchronously () &&
+         !schedule.empty () &&
+         ticks <= limit) {
+    const int lit = u2i (schedule.pop_front ());
+    if (noccs (lit) < 2) continue;
+    bva_lit (schedule, lit, ticks, limit);
+  }
+  stats.bva.ticks += ticks;
+
+  schedule.erase ();
+  reset_noccs ();
+  reset_occs ();
+
+  init_watches ();
+  connect_watches ();
+
+  const int64_t added_vars = stats.bva.vars - old_vars;
+#ifndef QUIET
+  const int64_t removed = stats.bva.removed - old_removed;
+  const int64_t added = stats.bva.added - old_added;
+#endif
+
+  PHASE ("bva", stats.bva.count,
+    "added %" PRId64 " variables and replaced %" PRId64
+    " clauses by %" PRId64 " clauses in %" PRId64 " ticks",
+    added_vars, removed, added, ticks);
+
+  if (added_vars) {
+    gaussian.stale = true;
+    cards.stale = true;
+  }
+
+  report ('a', !opts.reportall && !added_vars);
+
+  STOP_SIMPLIFIER (bva, BVA);
+}
+
+}
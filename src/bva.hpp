@@ -0,0 +1,23 @@
+#ifndef _bva_hpp_INCLUDED
+#define _bva_hpp_INCLUDED
+
+#include "heap.hpp"     // Alphabetically after 'bva.hpp'.
+
+namespace CaDiCaL {
+
+struct Internal;
+
+// Literals (as 'vlit') are tried in bounded variable addition with the
+// most occurrences first (see 'bva.cpp').
+
+struct bva_less_noccs {
+  Internal * internal;
+  bva_less_noccs (Internal * i) : internal (i) { }
+  bool operator () (unsigned a, unsigned b);
+};
+
+typedef heap<bva_less_noccs> BVASchedule;
+
+}
+
+#endif
@@ -54,6 +54,7 @@ class App : public Handler, public Terminator {
   //
   void print_usage (bool all = false);
   void print_witness (FILE *);
+  void print_backbone (FILE *, const std::vector<int> &);
 
 #ifndef QUIET
   void signal_message (const char * msg, int sig);
@@ -162,6 +163,7 @@ void App::print_usage (bool all) {
 "  --colors       force colored output\n"
 "  --no-colors    disable colored output to terminal\n"
 "  --no-witness   do not print witness (see also '-n' above)\n"
+"  --backbone     compute and print backbone instead of witness\n"
 "\n"
 "  --build        print build configuration\n"
 "  --copyright    print copyright information\n"
@@ -264,6 +266,26 @@ void App::print_witness (FILE * file) {
   if (c) fputc ('\n', file);
 }
 
+// Print backbone literals in the same format with 'b' lines.
+
+void App::print_backbone (FILE * file, const std::vector<int> & lits) {
+  int c = 0;
+  size_t i = 0;
+  int tmp;
+  do {
+    if (!c) fputc ('b', file), c = 1;
+    if (i == lits.size ()) tmp = 0;
+    else tmp = lits[i++];
+    char str[20];
+    sprintf (str, " %d", tmp);
+    int l = strlen (str);
+    if (c + l > 78) fputs ("\nb", file), c = 1;
+    fputs (str, file);
+    c += l;
+  } while (tmp);
+  if (c) fputc ('\n', file);
+}
+
 /*------------------------------------------------------------------------*/
 
 // Wrapper around option setting.
@@ -348,7 +370,8 @@ int App::main (int argc, char ** argv) {
 #ifndef __MINGW32__
   const char * time_limit_specified = 0;
 #endif
-  bool witness = true, less = false;
+  bool witness = true, less = false, backbone = false;
+  std::vector<int> backbone_lits;
   const char * dimacs_name, * err;
 
   for (int i = 1; i < argc; i++) {
@@ -413,6 +436,8 @@ int App::main (int argc, char ** argv) {
              !strcmp (argv[i], "--witness=false") ||
              !strcmp (argv[i], "--witness=0"))
       witness = false;
+    else if (!strcmp (argv[i], "--backbone"))
+      backbone = true;
     else if (!strcmp (argv[i], "--less")) {             // EXPERIMENTAL!
       if (less) APPERR ("multiple '--less' options");
       else if (!isatty (1))
@@ -644,6 +669,8 @@ int App::main (int argc, char ** argv) {
     err = solver->read_dimacs(stdin, dimacs_name, max_var, force_strict_parsing,
                             incremental, cube_literals);
   if (err) APPERR ("%s", err);
+  if (incremental && backbone)
+    APPERR ("can not compute backbone of incremental CNF with cubes");
   if (read_solution_path) {
     solver->section ("parsing solution");
     solver->message ("reading solution file from '%s'", read_solution_path);
@@ -779,7 +806,8 @@ int App::main (int argc, char ** argv) {
       res = 0;
   } else {
     solver->section ("solving");
-    res = solver->solve ();
+    if (backbone) res = solver->backbone (backbone_lits);
+    else res = solver->solve ();
   }
 
   if (proof_specified) {
@@ -817,7 +845,9 @@ int App::main (int argc, char ** argv) {
 
   if (res == 10) {
     fputs ("s SATISFIABLE\n", write_result_file);
-    if (witness)
+    if (backbone)
+      print_backbone (write_result_file, backbone_lits);
+    else if (witness)
       print_witness (write_result_file);
   } else if (res == 20) fputs ("s UNSATISFIABLE\n", write_result_file);
   else fputs ("c UNKNOWN\n", write_result_file);
@@ -194,6 +194,7 @@ struct External;
 
 class Learner;
 class Terminator;
+class ExternalPropagator;
 class ClauseIterator;
 class WitnessIterator;
 
@@ -332,6 +333,117 @@ public:
   void reset_assumptions ();
   void reset_constraint ();
 
+  //------------------------------------------------------------------------
+  // Bulk versions of 'add', 'assume' and 'val'.  They check the API
+  // contract only once per call (literals are still checked to be valid)
+  // and reserve the internal stacks in advance, which avoids the per
+  // literal call overhead of the IPASIR functions above for applications
+  // generating huge formulas.  Their semantics is the same as calling the
+  // corresponding function for each literal in turn, and thus they are
+  // also traced as a sequence of individual API calls.
+
+  // Add the clause consisting of the 'size' valid non-zero literals in
+  // 'lits' (no terminating zero is expected).  The clause has to be
+  // complete, i.e., no previous clause may be pending.
+  //
+  //   require (VALID & !adding_clause)
+  //   ensure (UNKNOWN)
+  //
+  void add_clause (const int * lits, size_t size);
+
+  // Add all the zero terminated clauses in the buffer 'lits' of 'size'
+  // literals.  The last literal has to be a zero (if 'size' is non-zero).
+  //
+  //   require (VALID & !adding_clause)
+  //   ensure (UNKNOWN)
+  //
+  void add_clauses (const int * lits, size_t size);
+
+  // Assume all the 'size' valid non-zero literals in 'lits'.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  void assume_all (const int * lits, size_t size);
+
+  // Write the value of the 'size' valid non-zero literals in 'lits' to the
+  // corresponding position in 'values' (as 'val' would return them).
+  //
+  //   require (SATISFIED)
+  //   ensure (SATISFIED)
+  //
+  void vals (const int * lits, int * values, size_t size);
+
+  //------------------------------------------------------------------------
+  // Clause groups.  All clauses added (with 'add' or the bulk functions)
+  // after 'open_group' and before the matching 'close_group' belong to the
+  // returned group.  As long as the group is not retracted its clauses are
+  // part of the formula in every 'solve' call.  Retracting a group removes
+  // its clauses and all learned clauses derived from them at once, while
+  // keeping all other learned clauses.
+  //
+  // Internally a group is an activation literal (the returned group is a
+  // fresh variable), which is added negatively to each clause of the group
+  // and is assumed automatically in 'solve', 'lookahead' and
+  // 'generate_cubes'.  Retraction adds its negation as unit and eagerly
+  // collects the now satisfied clauses.  The group variable is frozen
+  // while the group is active and can be given to 'failed' after an
+  // unsatisfiable 'solve' call to check whether the group was used.  Using
+  // a group variable (even of a retracted group) in clauses, assumptions,
+  // constraints or in 'phase', 'freeze' and 'melt' is a contract
+  // violation.  Only one group can be open at a time.  Group variables are
+  // counted by 'vars', such that 'vars () + 1' is always a fresh user
+  // variable, but they are never part of the result of 'backbone'.
+
+  // Open a new group and return its (positive) group variable.
+  //
+  //   require (READY & !group_open)
+  //   ensure (UNKNOWN & group_open)
+  //
+  int open_group ();
+
+  // Close the currently open group.  Clauses added afterwards belong to
+  // the formula permanently again.
+  //
+  //   require (READY & group_open)
+  //   ensure (READY & !group_open)
+  //
+  void close_group ();
+
+  // Remove all clauses of the given active group (closing it first if it
+  // is still open).  The group can not be used afterwards anymore.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  void retract_group (int group);
+
+  //------------------------------------------------------------------------
+  // External propagators allow to lazily add theory reasoning to the CDCL
+  // search (see 'ExternalPropagator' below).  The propagator is notified
+  // about assignments of observed variables, can propagate observed
+  // literals with reason clauses, add new clauses (over observed variables)
+  // and has to accept complete assignments before they are reported as
+  // satisfying.  There can only be one connected propagator.  Connecting a
+  // second (non-zero) one implicitly disconnects the first one.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_external_propagator (ExternalPropagator * propagator);
+  void disconnect_external_propagator ();
+
+  // Only assignments of observed variables are notified and only observed
+  // variables may occur in propagated literals, reason clauses and
+  // external clauses.  Observed variables are frozen and thus not removed
+  // by inprocessing (they are melted again by 'remove_observed_var').
+  //
+  //   require (VALID & var > 0)
+  //   ensure (VALID)
+  //
+  void add_observed_var (int var);
+  void remove_observed_var (int var);
+
   // Return the current state of the solver as defined above.
   //
   const State & state () const { return _state; }
@@ -369,7 +481,11 @@ public:
   // Variables are usually added and initialized implicitly whenever a
   // literal is used as an argument except for the functions 'val', 'fixed',
   // 'failed' and 'frozen'.  However, the library internally keeps a maximum
-  // variable index, which can be queried.
+  // variable index, which can be queried.  Variables added internally by
+  // bounded variable addition are hidden and not counted here.  The
+  // functions 'val', 'fixed' and 'failed' treat them as unused variables
+  // and traversed clauses and witnesses only contain them with indices
+  // larger than 'vars', i.e., as auxiliary variables.
   //
   //   require (VALID | SOLVING)
   //   ensure (VALID | SOLVING)
@@ -482,17 +598,20 @@ public:
   void optimize (int val);
 
   // Specify search limits, where currently 'name' can be "conflicts",
-  // "decisions", "preprocessing", or "localsearch".  The first two limits
-  // are unbounded by default.  Thus using a negative limit for conflicts or
-  // decisions switches back to the default of unlimited search (for that
-  // particular limit).  The preprocessing limit determines the number of
-  // preprocessing rounds, which is zero by default.  Similarly, the local
-  // search limit determines the number of local search rounds (also zero by
-  // default).  As with 'set', the return value denotes whether the limit
-  // 'name' is valid.  These limits are only valid for the next 'solve' or
-  // 'simplify' call and reset to their default after 'solve' returns (as
-  // well as overwritten and reset during calls to 'simplify' and
-  // 'lookahead').  We actually also have an internal "terminate" limit
+  // "decisions", "preprocessing", "localsearch", or "memory".  The first
+  // two limits are unbounded by default.  Thus using a negative limit for
+  // conflicts or decisions switches back to the default of unlimited search
+  // (for that particular limit).  The preprocessing limit determines the
+  // number of preprocessing rounds, which is zero by default.  Similarly,
+  // the local search limit determines the number of local search rounds
+  // (also zero by default).  The memory limit is given in MB (unlimited by
+  // default unless the 'memlimit' option is set).  If the resident set size
+  // exceeds it, learned clauses are flushed first and if that does not help
+  // 'solve' returns zero.  As with 'set', the return value denotes whether
+  // the limit 'name' is valid.  These limits are only valid for the next
+  // 'solve' or 'simplify' call and reset to their default after 'solve'
+  // returns (as well as overwritten and reset during calls to 'simplify'
+  // and 'lookahead').  We actually also have an internal "terminate" limit
   // which however should only be used for testing and debugging.
   //
   //   require (READY)
@@ -515,6 +634,18 @@ public:
   int64_t redundant () const;   // Number of active redundant clauses.
   int64_t irredundant () const; // Number of active irredundant clauses.
 
+  // Number of bytes currently allocated for the data structure 'name',
+  // which can be "arena", "clauses", "watches", "occs", "big", "pool",
+  // "extension", "checker", "proof" or "total" (the sum of the others).
+  // Clauses in the arena are not counted in "clauses".  The lists of "occs"
+  // and "big" are allocated from "pool" and counted there.  Returns a
+  // negative number for an invalid 'name'.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  int64_t memory (const char * name) const;
+
   //------------------------------------------------------------------------
   // This function executes the given number of preprocessing rounds. It is
   // similar to 'solve' with 'limits ("preprocessing", rounds)' except that
@@ -530,6 +661,24 @@ public:
   //
   int simplify (int rounds = 3);
 
+  //------------------------------------------------------------------------
+  // Compute the backbone of the formula under the current assumptions, i.e.,
+  // the literals which are true in all its models.  The result is 10 if the
+  // formula is satisfiable and then 'lits' contains the backbone literals
+  // ordered by variable index, 20 if it is unsatisfiable and 0 if a limit
+  // was hit or the solver was terminated (then 'lits' only contains the
+  // backbone literals found so far).  Internally the solver is called
+  // repeatedly with the negation of candidate literals as constraint, thus
+  // a constraint set by the user is ignored and reset.  Limits apply to
+  // each of these calls.  As 'solve' it resets assumptions and limits
+  // before returning.  Since the last internal call might have been
+  // unsatisfiable no model is available after a satisfiable result.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN | UNSATISFIED)
+  //
+  int backbone (std::vector<int> & lits);
+
   //------------------------------------------------------------------------
   // Force termination of 'solve' asynchronously.
   //
@@ -776,6 +925,7 @@ private:
   void trace_api_call (const char *) const;
   void trace_api_call (const char *, int) const;
   void trace_api_call (const char *, const char *, int) const;
+  void trace_api_calls (const char *, const int *, size_t, bool) const;
 #endif
 
   void transition_to_unknown_state ();
@@ -890,6 +1040,40 @@ public:
   virtual void learn (int lit) = 0;
 };
 
+// Connected external propagators are notified about assignments of observed
+// variables ('is_fixed' is true for root-level assignments), new decision
+// levels and backtracking (to the given decision level).  During search
+// 'cb_propagate' is asked for further implied literals (zero if there are
+// none).  For each of them 'cb_add_reason_clause_lit' has to return the
+// literals of a reason clause containing the propagated literal one by one
+// terminated by zero, all other literals being false.  Independently new
+// clauses can be added at any time 'cb_has_external_clause' returns true,
+// again literal by literal through 'cb_add_external_clause_lit'.  Finally
+// a complete assignment is only reported as satisfying if
+// 'cb_check_found_model' accepts the given assignment of the observed
+// variables.  If it rejects it, then it has to add at least one clause
+// falsified by this assignment afterwards.
+
+class ExternalPropagator {
+public:
+  virtual ~ExternalPropagator () { }
+
+  virtual void notify_assignment (int lit, bool is_fixed) = 0;
+  virtual void notify_new_decision_level () = 0;
+  virtual void notify_backtrack (size_t new_level) = 0;
+
+  virtual bool cb_check_found_model (const std::vector<int> & model) = 0;
+
+  virtual int cb_propagate () { return 0; }
+  virtual int cb_add_reason_clause_lit (int propagated_lit) {
+    (void) propagated_lit;
+    return 0;
+  }
+
+  virtual bool cb_has_external_clause () = 0;
+  virtual int cb_add_external_clause_lit () = 0;
+};
+
 /*------------------------------------------------------------------------*/
 
 // Allows to traverse all remaining irredundant clauses.  Satisfied and
@@ -0,0 +1,478 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Cardinality reasoning.  At-most-one constraints are detected as cliques
+// in the binary implication graph of the irredundant binary clauses.  Two
+// literals 'a' and 'b' can not both be true if '-b' is reachable from 'a'.
+// Direct edges cover the pairwise encoding, while reachability also covers
+// encodings with auxiliary variables such as the sequential counter.
+//
+// The at-most-one constraints are combined with irredundant clauses, which
+// are turned into at-most-k constraints by negating their literals, i.e.,
+// the clause '(a | b | c)' becomes 'at most 2 of -a, -b, -c'.  Then we
+// apply bounded Fourier-Motzkin elimination.  Eliminating the variable 'x'
+// adds 'at most k + l - 1 of A, B' for every 'at most k of A, x' and 'at
+// most l of B, -x' and a pair of complementary literals in 'A' and 'B'
+// reduces the bound by one.  If a literal occurs in both then the sum is
+// not a cardinality constraint anymore and we drop it (we only derive
+// implied constraints and thus can drop any of them).  This derives the
+// inconsistency of pigeon hole formulas in polynomial time, which CDCL
+// can only refute in exponential time.  A bound zero yields units.
+//
+// The derived non-trivial constraints are kept and propagated natively
+// during search by counting the true literals on the trail.  If the count
+// of a constraint reaches its bound all its other literals are propagated
+// to false and if it exceeds the bound we have a conflict.  As in Gaussian
+// elimination (see 'gauss.cpp') the reason and conflict clauses are added
+// on demand through 'add_lazy_clause' as redundant clauses and thus can be
+// handled by 'analyze' as any other clause.  On backtracking the counts of
+// the unassigned literals are decremented in 'card_backtrack'.
+//
+// These derivations can not be checked in clausal proofs and thus this
+// technique is disabled if a proof is traced or checked.  The constraints
+// become stale if variables are eliminated, substituted or compacted and
+// are only rebuilt at the root level.
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::carding () {
+  if (!opts.card) return false;
+  if (proof) return false;
+  return cards.stale;
+}
+
+inline double Internal::card_limit () {
+  return opts.cardmineff +
+    1e-3 * opts.cardreleff * stats.propagations.search;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Find at-most-one constraints over the literals of irredundant clauses of
+// size at most 'opts.cardcllim'.  The constraints are greedily grown
+// cliques of at least three literals (pairs are just binary clauses) and
+// every literal occurs in at most one of them.
+
+void Internal::find_amo_constraints (vector<Card> & constraints) {
+
+  assert (!level);
+
+  const int size_limit = opts.cardcllim;
+  const size_t reach_limit = opts.cardmaxsize;
+  const double limit = card_limit ();
+
+  vector<char> candidate (2*vsize, 0);
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->redundant) continue;
+    if (c->size > size_limit) continue;
+    for (const auto & lit : *c)
+      candidate[vlit (lit)] = 1;
+  }
+
+  BinGraph graph;
+  init_bin_graph (graph, false);
+
+  // Two candidates are adjacent if one implies the negation of the other.
+
+  vector<vector<int>> adjacent (2*vsize);
+  vector<char> seen (2*vsize, 0);
+  vector<int> reached;
+
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (stats.card.ticks > limit) break;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (!candidate[vlit (lit)]) continue;
+      if (!graph.degree (vlit (lit))) continue;
+      reached.push_back (lit);
+      seen[vlit (lit)] = 1;
+      for (size_t i = 0; i < reached.size (); i++) {
+        const unsigned u = vlit (reached[i]);
+        const size_t end = graph.end (u);
+        stats.card.ticks += 1 + graph.degree (u);
+        for (size_t k = graph.begin (u); k != end; k++) {
+          const int other = graph.targets[k];
+          if (reached.size () >= reach_limit) break;
+          if (seen[vlit (other)]) continue;
+          seen[vlit (other)] = 1;
+          reached.push_back (other);
+        }
+      }
+      for (const auto & other : reached) {
+        seen[vlit (other)] = 0;
+        const int neighbour = -other;
+        if (neighbour == lit) continue;
+        if (other == lit) continue;
+        if (!candidate[vlit (neighbour)]) continue;
+        adjacent[vlit (lit)].push_back (neighbour);
+        adjacent[vlit (neighbour)].push_back (lit);
+      }
+      reached.clear ();
+    }
+  }
+
+  erase_bin_graph (graph);
+  erase_vector (seen);
+
+  vector<int> schedule;
+  for (int idx = 1; idx <= max_var; idx++)
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      vector<int> & as = adjacent[vlit (lit)];
+      if (as.empty ()) continue;
+      sort (as.begin (), as.end ());
+      as.erase (unique (as.begin (), as.end ()), as.end ());
+      if (as.size () < 2) continue;
+      schedule.push_back (lit);
+    }
+
+  auto degree = [&] (int lit) { return adjacent[vlit (lit)].size (); };
+  auto more_adjacent = [&] (int a, int b) { return degree (a) > degree (b); };
+  stable_sort (schedule.begin (), schedule.end (), more_adjacent);
+
+  // The number of clique literals adjacent to a literal is counted in
+  // 'connected' and thus a literal can be added to the clique if it is
+  // connected to all clique literals.
+
+  vector<unsigned> connected (2*vsize, 0);
+  vector<char> used (2*vsize, 0);
+  vector<int> clique, touched, candidates;
+
+  for (const auto & lit : schedule) {
+    if (used[vlit (lit)]) continue;
+    candidates = adjacent[vlit (lit)];
+    stable_sort (candidates.begin (), candidates.end (), more_adjacent);
+    clique.push_back (lit);
+    for (const auto & other : adjacent[vlit (lit)])
+      if (!connected[vlit (other)]++) touched.push_back (other);
+    for (const auto & other : candidates) {
+      if (used[vlit (other)]) continue;
+      if (connected[vlit (other)] != clique.size ()) continue;
+      clique.push_back (other);
+      stats.card.ticks += 1 + degree (other);
+      for (const auto & next : adjacent[vlit (other)])
+        if (!connected[vlit (next)]++) touched.push_back (next);
+    }
+    for (const auto & other : touched)
+      connected[vlit (other)] = 0;
+    touched.clear ();
+    if (clique.size () >= 3) {
+      LOG (clique, "found at-most-one constraint");
+      stats.card.amos++;
+      for (const auto & other : clique)
+        used[vlit (other)] = 1;
+      Card card;
+      card.lits = clique;
+      card.bound = 1;
+      constraints.push_back (card);
+    }
+    clique.clear ();
+  }
+
+  // Add clauses which have a literal in an at-most-one constraint as
+  // 'at most size - 1 of the negated literals'.
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->redundant) continue;
+    if (c->size > size_limit) continue;
+    bool connected_clause = false;
+    for (const auto & lit : *c)
+      if (used[vlit (lit)]) connected_clause = true;
+    if (!connected_clause) continue;
+    Card card;
+    for (const auto & lit : *c)
+      card.lits.push_back (-lit);
+    card.bound = c->size - 1;
+    constraints.push_back (card);
+    stats.card.clauses++;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Fourier-Motzkin resolvent of 'a' containing 'pivot' and 'b' containing
+// '-pivot' in 'res'.  Returns 'false' if it is not a cardinality constraint.
+
+bool Internal::resolve_cards (const Card & a, const Card & b,
+                              int pivot, Card & res) {
+  assert (res.lits.empty ());
+  res.bound = a.bound + b.bound - 1;
+  res.derived = true;
+  for (const auto & lit : a.lits) {
+    if (lit == pivot) continue;
+    mark (lit);
+    res.lits.push_back (lit);
+  }
+  const size_t size_a = res.lits.size ();
+  bool duplicated = false;
+  for (const auto & lit : b.lits) {
+    if (lit == -pivot) continue;
+    const signed char tmp = marked (lit);
+    if (tmp > 0) duplicated = true;
+    else if (tmp < 0) unmark (lit), res.bound--;
+    else res.lits.push_back (lit);
+  }
+  size_t j = 0;
+  for (size_t i = 0; i < size_a; i++) {
+    const int lit = res.lits[i];
+    if (marked (lit) <= 0) continue;
+    unmark (lit);
+    res.lits[j++] = lit;
+  }
+  for (size_t i = size_a; i < res.lits.size (); i++)
+    res.lits[j++] = res.lits[i];
+  res.lits.resize (j);
+  stats.card.ticks += a.lits.size () + b.lits.size ();
+  return !duplicated;
+}
+
+// Bounded Fourier-Motzkin elimination of the variables occurring in the
+// constraints.  Variables are only eliminated if this does not increase
+// the number of constraints.  Negations of the literals of constraints with
+// bound zero are added to 'units'.
+
+void Internal::eliminate_cards (vector<Card> & constraints,
+                                vector<int> & units) {
+
+  const size_t size_limit = opts.cardmaxsize;
+  const int64_t resolvent_limit = stats.card.resolvents + opts.cardmaxres;
+  const double limit = card_limit ();
+
+  vector<vector<unsigned>> occurrences (2*vsize);
+  for (size_t i = 0; i < constraints.size (); i++)
+    for (const auto & lit : constraints[i].lits)
+      occurrences[vlit (lit)].push_back (i);
+
+  auto flush = [&] (vector<unsigned> & os) {
+    size_t j = 0;
+    for (size_t i = 0; i < os.size (); i++)
+      if (!constraints[os[i]].garbage) os[j++] = os[i];
+    os.resize (j);
+  };
+
+  bool changed = true;
+  while (!unsat && changed) {
+    changed = false;
+    for (int idx = 1; !unsat && idx <= max_var; idx++) {
+
+      if (stats.card.resolvents >= resolvent_limit) break;
+      if (stats.card.ticks > limit) break;
+
+      vector<unsigned> & pos = occurrences[vlit (idx)];
+      vector<unsigned> & neg = occurrences[vlit (-idx)];
+      flush (pos), flush (neg);
+      if (pos.empty () || neg.empty ()) continue;
+      if (pos.size () * neg.size () > pos.size () + neg.size ()) continue;
+
+      LOG ("eliminating variable %d in %zd cardinality constraints",
+        idx, pos.size () + neg.size ());
+
+      for (size_t i = 0; !unsat && i < pos.size (); i++) {
+        for (size_t j = 0; !unsat && j < neg.size (); j++) {
+          Card res;
+          stats.card.resolvents++;
+          if (!resolve_cards (constraints[pos[i]], constraints[neg[j]],
+                              idx, res)) continue;
+          const size_t size = res.lits.size ();
+          if (res.bound < 0) {
+            LOG ("Fourier-Motzkin elimination yields inconsistency");
+            learn_empty_clause ();
+          } else if (res.bound >= (int) size) {
+            LOG (res.lits, "trivial resolvent with bound %d", res.bound);
+          } else if (size > size_limit) {
+            LOG ("dropping resolvent of size %zd", size);
+          } else {
+            LOG (res.lits, "resolvent with bound %d", res.bound);
+            if (!res.bound)
+              for (const auto & lit : res.lits)
+                units.push_back (-lit);
+            const unsigned k = constraints.size ();
+            for (const auto & lit : res.lits)
+              occurrences[vlit (lit)].push_back (k);
+            constraints.push_back (res);
+          }
+        }
+      }
+
+      for (const auto & i : pos) constraints[i].garbage = true;
+      for (const auto & i : neg) constraints[i].garbage = true;
+      erase_vector (pos);
+      erase_vector (neg);
+      changed = true;
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Detect and derive cardinality constraints, assign derived units and keep
+// the non-trivial derived constraints for propagation.
+
+void Internal::card () {
+
+  if (unsat) return;
+  assert (carding ());
+
+  START (card);
+  stats.card.count++;
+
+  backtrack ();
+  cards.stale = false;
+  erase_vector (cards.constraints);
+  erase_vector (cards.occs);
+  cards.propagated = 0;
+
+  if (!propagate ()) {
+    learn_empty_clause ();
+    STOP (card);
+    return;
+  }
+
+  if (last.collect.fixed < stats.all.fixed) garbage_collection ();
+
+  vector<Card> constraints;
+  find_amo_constraints (constraints);
+#ifndef QUIET
+  const size_t found = constraints.size ();
+#endif
+
+  vector<int> units;
+  eliminate_cards (constraints, units);
+
+  size_t assigned = 0;
+  for (const auto & lit : units) {
+    if (unsat) break;
+    const signed char tmp = val (lit);
+    if (tmp > 0) continue;
+    if (tmp < 0) { learn_empty_clause (); break; }
+    LOG ("cardinality reasoning yields unit %d", lit);
+    assign_unit (lit);
+    assigned++;
+  }
+  stats.card.units += assigned;
+  if (!unsat && assigned && !propagate ()) learn_empty_clause ();
+
+  if (!unsat) {
+    for (auto & card : constraints) {
+      if (card.garbage) continue;
+      if (!card.derived) continue;
+      if (!card.bound) continue;
+      card.count = 0;
+      cards.constraints.push_back (move (card));
+    }
+    cards.occs.resize (2*vsize);
+    for (size_t i = 0; i < cards.constraints.size (); i++)
+      for (const auto & lit : cards.constraints[i].lits)
+        cards.occs[vlit (lit)].push_back (i);
+    stats.card.kept += cards.constraints.size ();
+  }
+
+  PHASE ("card", stats.card.count,
+    "found %zd constraints, kept %zd derived with %zd units",
+    found, cards.constraints.size (), assigned);
+
+  STOP (card);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called if the number of true literals of the constraint reached its
+// bound.  Either we find a conflict or propagate all unassigned literals
+// to false.  Literals which are already true but not counted yet are taken
+// into account too.
+
+void Internal::propagate_card (Card & card) {
+
+  vector<int> & reason = cards.reason;
+  assert (reason.empty ());
+
+  int count = 0;
+  for (const auto & lit : card.lits) {
+    if (val (lit) <= 0) continue;
+    if (var (lit).level) reason.push_back (-lit);
+    if (++count > card.bound) break;
+  }
+  stats.card.ticks += card.lits.size ();
+
+  if (count > card.bound) {
+    LOG (reason, "cardinality constraint conflict");
+    stats.card.conflicts++;
+    assert (clause.empty ());
+    clause = reason;
+    add_lazy_clause (true);
+  } else if (count == card.bound) {
+    const int before = level;
+    for (const auto & lit : card.lits) {
+      if (val (lit)) continue;
+      assert (clause.empty ());
+      clause.push_back (-lit);
+      for (const auto & other : reason)
+        clause.push_back (other);
+      LOG (clause, "cardinality constraint propagates %d with", -lit);
+      stats.card.propagations++;
+      add_lazy_clause (true);
+      if (conflict || unsat || level < before) break;
+    }
+  }
+  reason.clear ();
+}
+
+bool Internal::card_propagate () {
+
+  if (cards.constraints.empty ()) return true;
+  if (cards.stale) return true;
+
+  assert (!conflict);
+  assert (!unsat);
+  assert (propagated == trail.size ());
+
+  if (stats.card.ticks > card_limit ()) return true;
+
+  START (card);
+
+  while (!conflict && !unsat) {
+    if (cards.propagated == trail.size ()) {
+      if (propagated == trail.size ()) break;
+      if (!propagate ()) break;
+      continue;
+    }
+    const int lit = trail[cards.propagated++];
+    const unsigned ulit = vlit (lit);
+    if (ulit >= cards.occs.size ()) continue;
+    const vector<unsigned> & os = cards.occs[ulit];
+    stats.card.ticks += 1 + os.size ();
+    for (const auto & i : os)
+      cards.constraints[i].count++;
+    const int before = level;
+    for (const auto & i : os) {
+      Card & card = cards.constraints[i];
+      if (card.count < card.bound) continue;
+      propagate_card (card);
+      if (conflict || unsat || level < before) break;
+    }
+  }
+
+  STOP (card);
+
+  return !conflict && !unsat;
+}
+
+// Uncount the literals on the trail starting at position 'assigned'.
+
+void Internal::card_backtrack (size_t assigned) {
+  assert (assigned < cards.propagated);
+  if (!cards.stale) {
+    for (size_t i = assigned; i < cards.propagated; i++) {
+      const unsigned ulit = vlit (trail[i]);
+      if (ulit >= cards.occs.size ()) continue;
+      for (const auto & j : cards.occs[ulit])
+        cards.constraints[j].count--;
+    }
+  }
+  cards.propagated = assigned;
+}
+
+}
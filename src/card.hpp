@@ -0,0 +1,30 @@
+#ifndef _card_hpp_INCLUDED
+#define _card_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Cardinality constraints stating that at most 'bound' of the literals
+// are true.  They are detected and derived in 'card.cpp' and the derived
+// ones are propagated natively by counting true literals on the trail.
+
+struct Card {
+  vector<int> lits;             // literals of the constraint
+  int bound;                    // at most that many literals can be true
+  int count;                    // number of counted true literals
+  bool derived;                 // derived by Fourier-Motzkin elimination
+  bool garbage;                 // removed during elimination
+  Card () : bound (0), count (0), derived (false), garbage (false) { }
+};
+
+struct Cards {
+  vector<Card> constraints;     // natively propagated constraints
+  vector<vector<unsigned>> occs;// constraint indices for each literal
+  size_t propagated;            // trail literals counted so far
+  vector<int> reason;           // negated true literals of a constraint
+  bool stale;                   // needs to be rebuilt before being used
+  Cards () : propagated (0), stale (true) { }
+};
+
+}
+
+#endif
@@ -109,6 +109,21 @@ void ccadical_assume (CCaDiCaL * wrapper, int lit) {
   ((Wrapper*) wrapper)->solver->assume (lit);
 }
 
+void ccadical_add_clause (CCaDiCaL * wrapper,
+                          const int * lits, size_t size) {
+  ((Wrapper*) wrapper)->solver->add_clause (lits, size);
+}
+
+void ccadical_add_clauses (CCaDiCaL * wrapper,
+                           const int * lits, size_t size) {
+  ((Wrapper*) wrapper)->solver->add_clauses (lits, size);
+}
+
+void ccadical_assume_all (CCaDiCaL * wrapper,
+                          const int * lits, size_t size) {
+  ((Wrapper*) wrapper)->solver->assume_all (lits, size);
+}
+
 int ccadical_solve (CCaDiCaL * wrapper) {
   return ((Wrapper*) wrapper)->solver->solve ();
 }
@@ -121,6 +136,23 @@ int ccadical_val (CCaDiCaL * wrapper, int lit) {
   return ((Wrapper*) wrapper)->solver->val (lit);
 }
 
+void ccadical_vals (CCaDiCaL * wrapper,
+                    const int * lits, int * vals, size_t size) {
+  ((Wrapper*) wrapper)->solver->vals (lits, vals, size);
+}
+
+int ccadical_open_group (CCaDiCaL * wrapper) {
+  return ((Wrapper*) wrapper)->solver->open_group ();
+}
+
+void ccadical_close_group (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->solver->close_group ();
+}
+
+void ccadical_retract_group (CCaDiCaL * wrapper, int group) {
+  ((Wrapper*) wrapper)->solver->retract_group (group);
+}
+
 int ccadical_failed (CCaDiCaL * wrapper, int lit) {
   return ((Wrapper*) wrapper)->solver->failed (lit);
 }
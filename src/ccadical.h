@@ -7,6 +7,7 @@ extern "C" {
 #endif
 /*------------------------------------------------------------------------*/
 
+#include <stddef.h>
 #include <stdint.h>
 
 // C wrapper for CaDiCaL's C++ API following IPASIR.
@@ -48,6 +49,19 @@ int ccadical_frozen (CCaDiCaL *, int lit);
 void ccadical_melt (CCaDiCaL *, int lit);
 int ccadical_simplify (CCaDiCaL *);
 
+// Bulk versions of 'add', 'assume' and 'val' (see 'cadical.hpp').
+
+void ccadical_add_clause (CCaDiCaL *, const int * lits, size_t size);
+void ccadical_add_clauses (CCaDiCaL *, const int * lits, size_t size);
+void ccadical_assume_all (CCaDiCaL *, const int * lits, size_t size);
+void ccadical_vals (CCaDiCaL *, const int * lits, int * vals, size_t size);
+
+// Clause groups (see 'cadical.hpp').
+
+int ccadical_open_group (CCaDiCaL *);
+void ccadical_close_group (CCaDiCaL *);
+void ccadical_retract_group (CCaDiCaL *, int group);
+
 /*------------------------------------------------------------------------*/
 
 // Support legacy names used before moving to more IPASIR conforming names.
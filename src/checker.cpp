@@ -34,11 +34,16 @@ inline CheckerWatcher & Checker::watcher (int lit) {
 
 /*------------------------------------------------------------------------*/
 
+static size_t checker_clause_bytes (size_t size) {
+  return sizeof (CheckerClause) + (size - 2) * sizeof (int);
+}
+
 CheckerClause * Checker::new_clause () {
   const size_t size = simplified.size ();
   assert (size > 1), assert (size <= UINT_MAX);
-  const size_t bytes = sizeof (CheckerClause) + (size - 2) * sizeof (int);
+  const size_t bytes = checker_clause_bytes (size);
   CheckerClause * res = (CheckerClause *) new char [bytes];
+  bytes_clauses += bytes;
   res->next = 0;
   res->hash = last_hash;
   res->size = size;
@@ -72,6 +77,8 @@ void Checker::delete_clause (CheckerClause * c) {
     assert (c->size > 1);
     assert (num_clauses);
     num_clauses--;
+    assert (bytes_clauses >= checker_clause_bytes (c->size));
+    bytes_clauses -= checker_clause_bytes (c->size);
   } else {
     assert (num_garbage);
     num_garbage--;
@@ -121,6 +128,8 @@ void Checker::collect_garbage_clauses () {
     CheckerClause ** p = clauses + i, * c;
     while ((c = *p)) {
       if (clause_satisfied (c)) {
+        assert (bytes_clauses >= checker_clause_bytes (c->size));
+        bytes_clauses -= checker_clause_bytes (c->size);
         c->size = 0;                    // mark as garbage
         *p = c->next;
         c->next = garbage;
@@ -163,7 +172,7 @@ Checker::Checker (Internal * i)
   internal (i),
   size_vars (0), vals (0),
   inconsistent (false), num_clauses (0), num_garbage (0),
-  size_clauses (0), clauses (0), garbage (0),
+  size_clauses (0), bytes_clauses (0), clauses (0), garbage (0),
   next_to_propagate (0), last_hash (0)
 {
   LOG ("CHECKER new");
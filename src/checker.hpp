@@ -77,6 +77,7 @@ class Checker : public Observer {
   uint64_t num_clauses;         // number of clauses in hash table
   uint64_t num_garbage;         // number of garbage clauses
   uint64_t size_clauses;        // size of clause hash table
+  uint64_t bytes_clauses;       // bytes allocated for clauses
   CheckerClause ** clauses;     // hash table of clauses
   CheckerClause * garbage;      // linked list of garbage clauses
 
@@ -156,6 +157,8 @@ public:
   void add_derived_clause (const vector<int> &);
   void delete_clause (const vector<int> &);
 
+  size_t bytes () const;        // allocated memory in bytes
+
   void print_stats ();
   void dump ();                 // for debugging purposes only
 };
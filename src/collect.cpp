@@ -288,6 +288,8 @@ void Internal::copy_non_garbage_clauses () {
   // Prepare 'to' space of size 'moved_bytes'.
   //
   arena.prepare (moved_bytes);
+  stats.arenamoving++;
+  stats.arenamoved += moved_bytes;
 
   // Keep clauses in arena in the same order.
   //
@@ -410,6 +412,32 @@ bool Internal::arenaing () {
   return opts.arena && (stats.collections > 1);
 }
 
+// Young clauses allocated outside of the arena are collected without
+// moving any clause (a 'minor' collection) unless the space of deleted
+// clauses in the arena or the surviving young clauses exceed the limit
+// given by 'opts.arenaminor' relative to the size of the arena.  Setting
+// this option to zero compacts the arena during each collection.
+
+bool Internal::moving_garbage_collection () {
+  const size_t arena_bytes = arena.size ();
+  if (!arena_bytes) return true;
+  size_t tenured_bytes = 0, young_bytes = 0;
+  for (const auto & c : clauses) {
+    if (c->collect ()) continue;
+    const size_t bytes = c->bytes ();
+    if (arena.contains (c)) tenured_bytes += bytes;
+    else young_bytes += bytes;
+  }
+  assert (tenured_bytes <= arena_bytes);
+  const size_t unused_bytes = arena_bytes - tenured_bytes;
+  const double limit = 1e-2 * opts.arenaminor * arena_bytes;
+  LOG ("arena with %zd unused bytes and %zd young bytes (limit %.0f)",
+    unused_bytes, young_bytes, limit);
+  if (unused_bytes > limit) return true;
+  if (young_bytes > limit) return true;
+  return false;
+}
+
 void Internal::garbage_collection () {
   if (unsat) return;
   START (collect);
@@ -417,7 +445,8 @@ void Internal::garbage_collection () {
   stats.collections++;
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons) protect_reasons ();
-  if (arenaing ()) copy_non_garbage_clauses ();
+  if (arenaing () && moving_garbage_collection ())
+    copy_non_garbage_clauses ();
   else delete_garbage_clauses ();
   check_clause_stats ();
   check_var_stats ();
@@ -426,4 +455,23 @@ void Internal::garbage_collection () {
   STOP (collect);
 }
 
+/*------------------------------------------------------------------------*/
+
+// Called after the negated variable of a retracted clause group was added
+// as root-level unit.  Propagating it and collecting garbage removes the
+// clauses of the group and all learned clauses derived from them right
+// away, i.e., before the next 'solve' call and without waiting for
+// 'reduce' to find them.
+
+void Internal::collect_retracted () {
+  if (unsat) return;
+  if (level) backtrack ();
+  if (!propagate ()) {
+    LOG ("propagating retracted group unit yields conflict");
+    learn_empty_clause ();
+    return;
+  }
+  garbage_collection ();
+}
+
 }
@@ -161,6 +161,8 @@ void Internal::compact () {
   assert (active () < max_var);
 
   stats.compacts++;
+  gaussian.stale = true;
+  cards.stale = true;
 
   assert (!level);
   assert (!unsat);
@@ -172,6 +174,7 @@ void Internal::compact () {
   assert (control.size () == 1);
   assert (propagated == trail.size ());
 
+  notify_assignments ();                // before mapping the trail
   garbage_collection ();
 
   Mapper mapper (this);
@@ -253,7 +256,7 @@ void Internal::compact () {
   /*======================================================================*/
 
   mapper.map_flush_and_shrink_lits (trail);
-  propagated = trail.size ();
+  propagated = notified = trail.size ();
   if (mapper.first_fixed) {
     assert (trail.size () == 1);
     var (mapper.first_fixed).trail = 0;            // before mapping 'vtab'
@@ -94,6 +94,12 @@ do { \
     "invalid literal '%d'", (int)(LIT)); \
 } while (0)
 
+#define REQUIRE_NON_GROUP_LIT(LIT) \
+do { \
+  REQUIRE (!external->group_var (abs ((int)(LIT))), \
+    "literal '%d' is a group variable", (int)(LIT)); \
+} while (0)
+
 /*------------------------------------------------------------------------*/
 #else // NCONTRACTS
 /*------------------------------------------------------------------------*/
@@ -104,6 +110,7 @@ do { \
 #define REQUIRE_READY_STATE() do { } while (0)
 #define REQUIRE_VALID_OR_SOLVING_STATE() do { } while (0)
 #define REQUIRE_VALID_LIT(...) do { } while (0)
+#define REQUIRE_NON_GROUP_LIT(...) do { } while (0)
 
 /*------------------------------------------------------------------------*/
 #endif
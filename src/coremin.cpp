@@ -0,0 +1,180 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// The failed assumptions determined by 'failing' are all the assumptions
+// reached in the implication graph of the falsified assumption, which is
+// often far from a minimal core.  Clients (like MaxSAT solvers) then shrink
+// the core by calling 'solve' many times again.  If 'opts.coremin' is set
+// we do this directly after an unsatisfiable 'solve' call, which avoids
+// those external round trips.  First we try to remove assumptions by
+// propagation only, i.e., checking whether unit propagation of the
+// remaining assumptions still produces a conflict.  Then, if
+// 'opts.coremin > 1', we try to remove the remaining ones by solving
+// under the other assumptions with a conflict limit.  Both tests only
+// remove an assumption if the remaining ones are still inconsistent with
+// the formula, thus the result is always a core again.
+
+// Assign the given assumptions in order as decisions and propagate them.
+// Returns the length of the prefix of 'lits' which produced a conflict or
+// contained a falsified assumption and zero if there was none.  With
+// chronological backtracking there might be root-level units left on the
+// trail which still need to be propagated first.
+
+size_t Internal::propagate_core (const vector<int> & lits) {
+  assert (!level);
+  if (!propagate ()) {
+    LOG ("root level propagation produces conflict");
+    learn_empty_clause ();
+    return 0;
+  }
+  size_t res = 0;
+  for (size_t i = 0; !res && i < lits.size (); i++) {
+    const int lit = lits[i];
+    const signed char tmp = val (lit);
+    if (tmp < 0) res = i + 1;
+    else if (!tmp) {
+      search_assume_decision (lit);
+      if (!propagate ()) res = i + 1;
+    }
+  }
+  if (level) backtrack ();
+  conflict = 0;
+  return res;
+}
+
+// A bounded version of the CDCL loop in 'internal.cpp' without restarts
+// and inprocessing, which returns zero if the conflict limit is hit.
+
+int Internal::search_core (int64_t conflicts) {
+  const int64_t limit = stats.conflicts + conflicts;
+  int res = 0;
+  while (!res) {
+         if (unsat) res = 20;
+    else if (!propagate ()) analyze ();
+    else if (iterating) iterate ();
+    else if (satisfied ()) res = 10;
+    else if (stats.conflicts >= limit) break;
+    else if (terminated_asynchronously ()) break;
+    else res = decide ();
+  }
+  return res;
+}
+
+void Internal::minimize_failed_assumptions () {
+
+  if (!opts.coremin) return;
+  if (unsat || unsat_constraint) return;
+  if (!constraint.empty ()) return;
+  if (assumptions.size () < 2) return;
+
+  if (!marked_failed) {
+    failing ();
+    marked_failed = true;
+  }
+
+  vector<int> core;
+  for (const auto & lit : assumptions)
+    if (failed (lit)) core.push_back (lit);
+
+  const size_t original = core.size ();
+  if (original < 2) return;
+
+  START (coremin);
+  stats.coremin.count++;
+  stats.coremin.original += original;
+
+  // During minimization the assumptions are replaced by the tested subset
+  // and the failed flags are only set for the final core at the end.
+  //
+  vector<int> saved;
+  swap (saved, assumptions);
+
+  for (const auto & lit : core) {
+    Flags & f = flags (lit);
+    f.failed &= ~bign (lit);
+  }
+
+  if (level) backtrack ();
+
+  // Removing the suffix after the first conflict and then each assumption
+  // (from the last to the first) by propagation only.
+  //
+  vector<int> test;
+  if (!unsat) {
+    const size_t needed = propagate_core (core);
+    if (needed) core.resize (needed);
+  }
+  for (size_t i = core.size (); !unsat && i-- > 0; ) {
+    test.clear ();
+    for (size_t j = 0; j < core.size (); j++)
+      if (j != i) test.push_back (core[j]);
+    const size_t needed = propagate_core (test);
+    if (!needed) continue;
+    LOG ("propagation removes failed assumption %d", core[i]);
+    test.resize (needed);
+    swap (core, test);
+    if (i > core.size ()) i = core.size ();
+  }
+  const size_t propagated = original - core.size ();
+  stats.coremin.propagated += propagated;
+
+  // Removing each assumption (again from the last to the first) by
+  // bounded search under the remaining assumptions.  If this search
+  // succeeds the new core consists of the failed remaining assumptions.
+  //
+  if (opts.coremin > 1) {
+    for (size_t i = core.size (); !unsat && i-- > 0; ) {
+      if (terminated_asynchronously ()) break;
+      stats.coremin.tests++;
+      assumptions.clear ();
+      for (size_t j = 0; j < core.size (); j++)
+        if (j != i) assumptions.push_back (core[j]);
+      const int res = search_core (opts.coreminconflicts);
+      if (res == 20 && !unsat) {
+        LOG ("bounded search removes failed assumption %d", core[i]);
+        failing ();
+        test.clear ();
+        for (const auto & lit : assumptions) {
+          Flags & f = flags (lit);
+          const unsigned bit = bign (lit);
+          if (!(f.failed & bit)) continue;
+          f.failed &= ~bit;
+          test.push_back (lit);
+        }
+        swap (core, test);
+        if (i > core.size ()) i = core.size ();
+      }
+      if (level) backtrack ();
+      conflict = 0;
+    }
+    stats.coremin.searched += original - propagated - core.size ();
+  }
+
+  swap (saved, assumptions);
+
+  // Finally mark the literals in the minimized core as failed and (as in
+  // 'failing') check and trace the (implied) negation of the core.
+  //
+  for (const auto & lit : core) {
+    Flags & f = flags (lit);
+    f.failed |= bign (lit);
+    clause.push_back (-lit);
+  }
+  if (!unsat) {
+    external->check_learned_clause ();
+    if (proof) {
+      proof->add_derived_clause (clause);
+      proof->delete_clause (clause);
+    }
+  }
+  clause.clear ();
+  marked_failed = true;
+
+  VERBOSE (1, "minimized %zd failed assumptions to %zd %.0f%%",
+    original, core.size (), percent (core.size (), original));
+
+  STOP (coremin);
+}
+
+}
@@ -32,6 +32,8 @@ bool Internal::decompose_round () {
   START_SIMPLIFIER (decompose, DECOMP);
 
   stats.decompositions++;
+  gaussian.stale = true;
+  cards.stale = true;
 
   const size_t size_dfs = 2*(1 + (size_t) max_var);
   DFS * dfs = new DFS[size_dfs];
@@ -47,6 +49,9 @@ bool Internal::decompose_round () {
   vector<int> work;                     // depth first search working stack
   vector<int> scc;                      // collects members of one SCC
 
+  BinGraph graph;                       // binary implication graph
+  init_bin_graph (graph, true);
+
   // The binary implication graph might have disconnected components and
   // thus we have in general to start several depth first searches.
 
@@ -69,10 +74,11 @@ bool Internal::decompose_round () {
         } else {
           assert (!reprs [vlit (parent)]);
 
-          // Go over all implied literals, thus need to iterate over all
-          // binary watched clauses with the negation of 'parent'.
+          // Go over all implied literals, which are consecutive in the
+          // snapshot of the binary implication graph.
 
-          Watches & ws = watches (-parent);
+          const unsigned u = vlit (parent);
+          const size_t begin = graph.begin (u), end = graph.end (u);
 
           // Two cases: Either the node has never been visited before, i.e.,
           // it's depth first search index is zero, then perform the
@@ -90,9 +96,8 @@ bool Internal::decompose_round () {
 
             unsigned new_min = parent_dfs.min;
 
-            for (const auto & w : ws) {
-              if (!w.binary ()) continue;
-              const int child = w.blit;
+            for (size_t i = begin; i != end; i++) {
+              const int child = graph.targets[i];
               if (!active (child)) continue;
               const DFS & child_dfs = dfs[vlit (child)];
               if (new_min > child_dfs.min) new_min = child_dfs.min;
@@ -169,9 +174,8 @@ bool Internal::decompose_round () {
             // Now traverse all the children in the binary implication
             // graph but keep 'parent' on the stack for 'post-fix' work.
 
-            for (const auto & w : ws) {
-              if (!w.binary ()) continue;
-              const int child = w.blit;
+            for (size_t i = begin; i != end; i++) {
+              const int child = graph.targets[i];
               if (!active (child)) continue;
               const DFS & child_dfs = dfs[vlit (child)];
               if (child_dfs.idx) continue;
@@ -185,6 +189,7 @@ bool Internal::decompose_round () {
 
   erase_vector (work);
   erase_vector (scc);
+  erase_bin_graph (graph);
   delete [] dfs;
 
   // Only keep the representatives 'repr' mapping.
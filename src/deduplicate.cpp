@@ -136,4 +136,112 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
   report ('2', !opts.reportall && !(subsumed + units));
 }
 
+/*------------------------------------------------------------------------*/
+
+// Duplicated larger clauses are only found indirectly by 'subsume' which
+// is limited and only considers clauses likely to be kept.  Encodings
+// generated by tools often contain many such exact duplicates, which can
+// be removed in expected linear time by hashing.  The hash of a clause is
+// the sum of the hashes of its literals, which does not depend on the
+// order of its literals.  Thus we neither have to sort the literals nor
+// copy them.  After radix sorting clauses by hash (and size) clauses with
+// the same hash are compared by marking the literals of the first.  This
+// does not need watches and the removed duplicates are deleted in the
+// proof as soon they are collected.
+
+struct DedupClause {
+  uint64_t hash;
+  Clause * clause;
+  DedupClause (uint64_t h, Clause * c) : hash (h), clause (c) { }
+  DedupClause () { }
+};
+
+struct dedup_clause_rank {
+  typedef uint64_t Type;
+  Type operator () (const DedupClause & a) { return a.hash; }
+};
+
+// Literals are hashed by the finalizer of 'splitmix64', since a linear
+// hash function would make the sum only depend on the sum of literals.
+
+inline uint64_t Internal::dedup_hash (Clause * c) {
+  uint64_t res = (uint64_t) c->size;
+  for (const auto & lit : *c) {
+    uint64_t h = (uint64_t) vlit (lit) + 0x9e3779b97f4a7c15ull;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+    res += h ^ (h >> 31);
+  }
+  return res;
+}
+
+// If a duplicated pair contains an irredundant clause, the irredundant
+// clause is kept.  Among redundant clauses the one with smaller glue is
+// kept.  Thus we never have to turn a redundant clause into an
+// irredundant one as in 'subsume_clause'.
+
+inline bool dedup_keep_instead (Clause * kept, Clause * other) {
+  if (kept->redundant != other->redundant) return kept->redundant;
+  if (!kept->redundant) return false;
+  return other->glue < kept->glue;
+}
+
+void Internal::mark_duplicated_clauses_as_garbage () {
+
+  if (!opts.deduplicate) return;
+  if (unsat) return;
+  if (terminated_asynchronously ()) return;
+
+  START (deduplicate);
+  stats.deduplications++;
+
+  assert (!level);
+
+  last.deduplicate.added = stats.added.total;
+
+  vector<DedupClause> hashed;
+  for (const auto & c : clauses)
+    if (!c->garbage)
+      hashed.push_back (DedupClause (dedup_hash (c), c));
+
+  rsort (hashed.begin (), hashed.end (), dedup_clause_rank ());
+
+  int64_t duplicated = 0;
+
+  const auto end = hashed.end ();
+  auto i = hashed.begin ();
+  while (i != end) {
+    auto j = i + 1;
+    while (j != end && j->hash == i->hash) j++;
+    for (auto k = i; k + 1 != j; k++) {
+      Clause * c = k->clause;
+      if (c->garbage) continue;
+      mark (c);
+      for (auto l = k + 1; l != j; l++) {
+        Clause * d = l->clause;
+        if (d->garbage) continue;
+        if (d->size != c->size) continue;
+        bool same = true;
+        for (const auto & lit : *d)
+          if (marked (lit) <= 0) { same = false; break; }
+        if (!same) continue;
+        if (dedup_keep_instead (c, d)) swap (c, d);
+        LOG (d, "mark garbage duplicated");
+        stats.subsumed++;
+        stats.deduplicated++;
+        duplicated++;
+        mark_garbage (d);
+      }
+      unmark (c);
+    }
+    i = j;
+  }
+  erase_vector (hashed);
+
+  PHASE ("deduplicate", stats.deduplications,
+    "removed %" PRId64 " duplicated clauses", duplicated);
+
+  STOP (deduplicate);
+}
+
 }
@@ -830,6 +830,8 @@ void Internal::elim (bool update_limits) {
   if (!propagate ()) { learn_empty_clause (); return; }
 
   stats.elimphases++;
+  gaussian.stale = true;
+  cards.stale = true;
   PHASE ("elim-phase", stats.elimphases,
     "starting at most %d elimination rounds",
     opts.elimrounds);
@@ -7,9 +7,11 @@ External::External (Internal * i)
   internal (i),
   max_var (0),
   vsize (0),
+  group (0),
   extended (false),
   terminator (0),
   learner (0),
+  propagator (0),
   solution (0),
   vars (max_var)
 {
@@ -71,6 +73,84 @@ void External::init (int new_max_var) {
 
 /*------------------------------------------------------------------------*/
 
+int External::new_hidden_var () {
+  assert (max_var < INT_MAX);
+  const int eidx = max_var + 1;
+  init (eidx);
+  if ((size_t) eidx >= hiddentab.size ())
+    hiddentab.resize (1 + (size_t) eidx, false);
+  hiddentab[eidx] = true;
+  const int ilit = e2i[eidx];
+  assert (ilit > 0);
+  internal->mark_active (ilit);
+  LOG ("new hidden external %d mapped to internal %d", eidx, ilit);
+  return ilit;
+}
+
+// The user refers to the index 'eidx' of a hidden variable.  We move the
+// hidden variable to the next free external index and leave 'eidx' as
+// unused variable, which is then mapped to a new internal variable by
+// 'internalize'.  The only external literals of the hidden variable which
+// have to be renamed are those on the extension stack.
+
+void External::reveal (int eidx) {
+  assert (hidden (eidx));
+  assert (max_var < INT_MAX);
+  assert (!frozen (eidx));
+  assert (!observed (eidx));
+  const int moved = max_var + 1;
+  if ((size_t) moved >= vsize) enlarge (moved);
+  LOG ("relocating hidden external %d to %d", eidx, moved);
+  const int ilit = e2i[eidx];
+  e2i.push_back (ilit);
+  e2i[eidx] = 0;
+  if (ilit) {
+    int & ref = internal->i2e[abs (ilit)];
+    if (ref == eidx) ref = moved;
+  }
+  for (auto & lit : extension)
+    if (lit == eidx) lit = moved;
+    else if (lit == -eidx) lit = -moved;
+  max_var = moved;
+  for (int sign = -1; sign <= 1; sign += 2) {
+    const int lit = sign * eidx, other = sign * moved;
+    if (marked (witness, lit)) unmark (witness, lit), mark (witness, other);
+    if (marked (tainted, lit)) unmark (tainted, lit), mark (tainted, other);
+  }
+  if ((size_t) eidx < vals.size ()) {
+    vals.resize (1 + (size_t) moved, false);
+    vals[moved] = vals[eidx];
+    vals[eidx] = false;
+  }
+  if (internal->opts.checkfrozen) {
+    assert (!moltentab[eidx]);
+    moltentab.resize (1 + (size_t) moved, false);
+  }
+  hiddentab.resize (1 + (size_t) moved, false);
+  hiddentab[moved] = true;
+  hiddentab[eidx] = false;
+}
+
+int External::user_max_var () const {
+  int res = max_var;
+  while (res && hidden (res)) res--;
+  return res;
+}
+
+// Hidden variables with a smaller index than a user variable would look
+// like user variables in traversed clauses and witnesses (as well as in
+// files written by 'write_dimacs' and 'write_extension').  Thus before
+// traversal they are relocated above all user variables, where they appear
+// as fresh auxiliary variables to the user.
+
+void External::lift_hidden_vars () {
+  const int user = user_max_var ();
+  for (int eidx = 1; eidx < user; eidx++)
+    if (hidden (eidx)) reveal (eidx);
+}
+
+/*------------------------------------------------------------------------*/
+
 void External::reset_assumptions () {
   assumptions.clear ();
   internal->reset_assumptions ();
@@ -99,6 +179,7 @@ int External::internalize (int elit) {
     assert (elit != INT_MIN);
     const int eidx = abs (elit);
     if (eidx > max_var) init (eidx);
+    else if (hidden (eidx)) reveal (eidx);
     ilit = e2i [eidx];
     if (elit < 0) ilit = -ilit;
     if (!ilit) {
@@ -132,6 +213,12 @@ int External::internalize (int elit) {
 }
 
 void External::add (int elit) {
+  assert (elit != INT_MIN);
+  if (!elit && group) add_literal (-group);
+  add_literal (elit);
+}
+
+void External::add_literal (int elit) {
   assert (elit != INT_MIN);
   reset_extended ();
   if (internal->opts.check &&
@@ -153,11 +240,40 @@ void External::assume (int elit) {
   internal->assume (ilit);
 }
 
+/*------------------------------------------------------------------------*/
+
+// For the bulk versions we initialize all variables up-front and reserve
+// the external stacks, such that the individual 'add' and 'assume' calls
+// (which are in this compilation unit and thus can be inlined) do not have
+// to enlarge tables literal by literal.
+
+void External::add (const int * elits, size_t size, int max_idx) {
+  reset_extended ();
+  if (max_idx > max_var) init (max_idx);
+  if (internal->opts.check &&
+      (internal->opts.checkwitness || internal->opts.checkfailed))
+    original.reserve (original.size () + size);
+  for (const int * p = elits; p != elits + size; p++)
+    add (*p);
+}
+
+void External::assume (const int * elits, size_t size, int max_idx) {
+  reset_extended ();
+  if (max_idx > max_var) init (max_idx);
+  assumptions.reserve (assumptions.size () + size);
+  internal->assumptions.reserve (internal->assumptions.size () + size);
+  for (const int * p = elits; p != elits + size; p++)
+    assume (*p);
+}
+
+/*------------------------------------------------------------------------*/
+
 bool External::failed (int elit) {
   assert (elit);
   assert (elit != INT_MIN);
   int eidx = abs (elit);
   if (eidx > max_var) return 0;
+  if (hidden (eidx)) return 0;
   int ilit = e2i[eidx];
   if (!ilit) return 0;
   if (elit < 0) ilit = -ilit;
@@ -182,11 +298,69 @@ bool External::failed_constraint () {
   return internal->failed_constraint ();
 }
 
+/*------------------------------------------------------------------------*/
+
+int External::open_group () {
+  assert (!group);
+  assert (max_var < INT_MAX);
+  reset_extended ();
+  group = max_var + 1;
+  init (group);
+  freeze (group);
+  groups.push_back (group);
+  if ((size_t) group >= grouptab.size ())
+    grouptab.resize (1 + (size_t) group, false);
+  grouptab[group] = true;
+  LOG ("opened group %d", group);
+  return group;
+}
+
+void External::close_group () {
+  assert (group);
+  LOG ("closed group %d", group);
+  group = 0;
+}
+
+bool External::active_group (int g) const {
+  if (g <= 0 || g > max_var) return false;
+  return find (groups.begin (), groups.end (), g) != groups.end ();
+}
+
+// Retracting a group adds the negation of its group variable as unit.
+// All clauses of the group and all learned clauses derived from them
+// contain this literal (group variables only occur negatively and are
+// frozen, thus never resolved away) and become root-level satisfied.  The
+// internal solver then collects them eagerly instead of waiting for the
+// next reduction or garbage collection triggered during search.
+
+void External::retract_group (int g) {
+  assert (active_group (g));
+  if (group == g) close_group ();
+  const auto end = groups.end ();
+  const auto i = find (groups.begin (), end, g);
+  assert (i != end);
+  groups.erase (i);
+  LOG ("retracting group %d", g);
+  add_literal (-g);
+  add_literal (0);
+  melt (g);
+  internal->collect_retracted ();
+}
+
+void External::assume_groups () {
+  for (const auto g : groups) {
+    const int ilit = internalize (g);
+    LOG ("assuming group %d as internal %d", g, ilit);
+    internal->assume (ilit);
+  }
+}
+
 void External::phase (int elit) {
   assert (elit);
   assert (elit != INT_MIN);
   int eidx = abs (elit);
   if (eidx > max_var) return;
+  if (hidden (eidx)) return;
   int ilit = e2i[eidx];
   if (!ilit) return;
   if (elit < 0) ilit = -ilit;
@@ -198,6 +372,7 @@ void External::unphase (int elit) {
   assert (elit != INT_MIN);
   int eidx = abs (elit);
   if (eidx > max_var) return;
+  if (hidden (eidx)) return;
   int ilit = e2i[eidx];
   if (!ilit) return;
   if (elit < 0) ilit = -ilit;
@@ -251,6 +426,8 @@ void External::update_molten_literals () {
       molten++;
     } else if (frozen (lit))
       LOG ("skipping currently frozen literal %d", lit);
+    else if (hidden (lit))
+      LOG ("skipping hidden literal %d", lit);
     else {
       LOG ("new molten literal %d", lit);
       moltentab[lit] = true;
@@ -265,6 +442,7 @@ void External::update_molten_literals () {
 int External::solve (bool preprocess_only) {
   reset_extended ();
   update_molten_literals ();
+  assume_groups ();
   int res = internal->solve (preprocess_only);
   check_solve_result (res);
   reset_limits ();
@@ -276,6 +454,7 @@ void External::terminate () { internal->terminate (); }
 int External::lookahead () {
   reset_extended ();
   update_molten_literals ();
+  assume_groups ();
   int ilit = internal->lookahead ();
   const int elit = (ilit && ilit != INT_MIN) ? internal->externalize (ilit) : 0;
   LOG ("lookahead internal %d external %d", ilit, elit);
@@ -286,6 +465,7 @@ CaDiCaL::CubesWithStatus External::generate_cubes (int depth, int min_depth = 0)
   reset_extended ();
   update_molten_literals ();
   reset_limits ();
+  assume_groups ();
   auto cubes = internal->generate_cubes (depth, min_depth);
   auto externalize = [this](int ilit) {
     const int elit = ilit ? internal->externalize (ilit) : 0;
@@ -416,6 +596,12 @@ void External::check_failing () {
     checker->add (lit);
     checker->add (0);
   }
+  for (const auto g : groups) {
+    if (!failed (g)) continue;
+    LOG ("checking failed group %d in core", g);
+    checker->add (g);
+    checker->add (0);
+  }
   if (failed_constraint ()) {
     LOG (constraint, "checking failed constraint");
     for (const auto lit : constraint)
@@ -552,12 +738,17 @@ void External::export_learned_empty_clause () {
     LOG ("not exporting learned empty clause");
 }
 
+// Learned clauses over hidden variables are meaningless to the user and
+// thus are not exported.
+
 void External::export_learned_unit_clause (int ilit) {
   assert (learner);
-  if (learner->learning (1)) {
+  const int elit = internal->externalize (ilit);
+  assert (elit);
+  if (hidden (abs (elit)))
+    LOG ("not exporting learned unit clause on hidden variable");
+  else if (learner->learning (1)) {
     LOG ("exporting learned unit clause");
-    const int elit = internal->externalize (ilit);
-    assert (elit);
     learner->learn (elit);
     learner->learn (0);
   } else
@@ -568,6 +759,11 @@ void External::export_learned_large_clause (const vector<int> & clause) {
   assert (learner);
   size_t size = clause.size ();
   assert (size <= (unsigned) INT_MAX);
+  for (auto ilit : clause)
+    if (hidden (abs (internal->externalize (ilit)))) {
+      LOG ("not exporting learned clause with hidden variable");
+      return;
+    }
   if (learner->learning ((int) size)) {
     LOG ("exporting learned clause of size %zu", size);
     for (auto ilit : clause) {
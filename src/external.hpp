@@ -63,6 +63,15 @@ struct External {
   vector<int> assumptions;    // External assumptions.
   vector<int> constraint;     // External constraint. Terminated by zero.
 
+  int group;                  // Currently open clause group (or zero).
+  vector<int> groups;         // Active (not yet retracted) clause groups.
+  vector<bool> grouptab;      // Variables ever used as group variable.
+
+  bool group_var (int eidx) const {
+    assert (0 < eidx);
+    return (size_t) eidx < grouptab.size () && grouptab[eidx];
+  }
+
   // The extension stack for reconstructing complete satisfying assignments
   // (models) of the original external formula is kept in this external
   // solver object. It keeps track of blocked clauses and clauses containing
@@ -78,6 +87,25 @@ struct External {
 
   vector<unsigned> frozentab; // Reference counts for frozen variables.
 
+  // Variables added by the solver itself during bounded variable addition
+  // ('bva.cpp') get fresh external indices too, which keeps the extension
+  // stack and everything else working on external literals unchanged.
+  // These hidden variables are not reported as user variables by 'vars'.
+  // If the user later refers to a hidden index, the hidden variable is
+  // relocated to a new external index first ('reveal').
+
+  vector<bool> hiddentab;     // Hidden external variables.
+
+  bool hidden (int eidx) const {
+    assert (0 < eidx);
+    return (size_t) eidx < hiddentab.size () && hiddentab[eidx];
+  }
+
+  int new_hidden_var ();      // Returns internal literal of new variable.
+  void reveal (int eidx);     // Relocate hidden 'eidx' to new index.
+  int user_max_var () const;  // Maximum non-hidden variable index.
+  void lift_hidden_vars ();   // Relocate hidden below 'user_max_var'.
+
   // Regularly checked terminator if non-zero.  The terminator is set from
   // 'Solver::set (Terminator *)' and checked by 'Internal::terminating ()'.
 
@@ -91,6 +119,25 @@ struct External {
   void export_learned_unit_clause (int ilit);
   void export_learned_large_clause (const vector<int> &);
 
+  // If there is an external propagator, notify it about assignments of
+  // observed variables and use its propagations and clauses during search
+  // (see 'propagator.cpp').  Observed variables are frozen.
+
+  ExternalPropagator * propagator;
+  vector<bool> observedtab;   // Observed external variables.
+
+  bool observed (int elit) const {
+    assert (elit);
+    assert (elit != INT_MIN);
+    const size_t eidx = abs (elit);
+    return eidx < observedtab.size () && observedtab[eidx];
+  }
+
+  void connect_propagator (ExternalPropagator *);
+  void disconnect_propagator ();
+  void add_observed_var (int elit);
+  void remove_observed_var (int elit);
+
   //----------------------------------------------------------------------//
 
   signed char * solution;     // Given solution checking for debugging.
@@ -255,6 +302,15 @@ struct External {
   void assume (int elit);
   int solve (bool preprocess_only);
 
+  void add_literal (int elit);  // 'add' without adding the open group.
+
+  // Bulk versions of 'add' and 'assume' used by 'Solver::add_clause',
+  // 'Solver::add_clauses' and 'Solver::assume_all'.  The literals have
+  // already been checked and 'max_idx' is their maximum variable index.
+  //
+  void add (const int * elits, size_t size, int max_idx);
+  void assume (const int * elits, size_t size, int max_idx);
+
   // We call it 'ival' as abbreviation for 'val' with 'int' return type to
   // avoid bugs due to using 'signed char tmp = val (lit)', which might turn
   // a negative value into a positive one (happened in 'extend').
@@ -269,6 +325,15 @@ struct External {
     return res;
   }
 
+  // Hidden variables are unknown to the user and thus for the API we
+  // return the same value for them as for never used variables.
+
+  inline int user_ival (int elit) const {
+    assert (elit != INT_MIN);
+    if (hidden (abs (elit))) return elit < 0 ? 1 : -1;
+    return ival (elit);
+  }
+
   bool failed (int elit);
 
   void terminate ();
@@ -293,9 +358,30 @@ struct External {
 
   /*----------------------------------------------------------------------*/
 
+  // Clause groups are implemented with activation literals.  While a group
+  // is open its (positive) group variable is added negatively to every
+  // added clause.  All active group variables are assumed internally
+  // before solving and thus do not show up in 'assumptions'.
+
+  int open_group ();
+  void close_group ();
+  void retract_group (int group);
+
+  bool active_group (int group) const;
+  void assume_groups ();
+
+  /*----------------------------------------------------------------------*/
+
   int lookahead();
   CaDiCaL::CubesWithStatus generate_cubes(int, int);
 
+  // Backbone computation in 'backbone.cpp'.
+
+  int backbone_solve ();
+  void backbone_filter (vector<int> & candidates, vector<int> & lits,
+                        bool filter);
+  int backbone (vector<int> & lits);
+
   int fixed (int elit) const;   // Implemented in 'internal.hpp'.
 
   /*----------------------------------------------------------------------*/
@@ -0,0 +1,499 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Gauss-Jordan elimination of XOR constraints.  XORs are extracted from
+// the irredundant clauses with the same technique as in 'find_xor_gate'
+// used during variable elimination, i.e., for each candidate clause all
+// the clauses with the same variables and an even number of flipped
+// literals are searched for with 'find_clause' in occurrence lists.  The
+// XORs are then partitioned into independent matrices and each matrix is
+// brought into reduced row echelon form.  Rows are bit-vectors over the
+// columns (variables) packed into 64-bit words and row operations are
+// word-wise exclusive-or operations.
+//
+// During search, after unit propagation reached a fixpoint, we start from
+// the reduced matrix and only need to find new pivots for rows whose pivot
+// column has been assigned (eliminating the new pivot column from all
+// other rows).  Then each row with only its pivot column unassigned
+// propagates the pivot and each row with all columns assigned and the
+// wrong parity is a conflict.  Reason and conflict clauses are generated
+// from the row (which is a sum of original XORs) on demand and added as
+// redundant clauses through 'add_lazy_clause', such that 'analyze' treats
+// them as any other clause and 'reduce' can collect them later.
+//
+// Since sums of XORs are not derivable by resolution steps checked in
+// clausal proofs, Gaussian elimination is disabled if a proof is traced or
+// checked.  The matrices become stale if variables are eliminated,
+// substituted or compacted and are only rebuilt at the root level.
+//
+// Extraction and propagation share one effort limit in 'stats.gauss.ticks'
+// relative to search propagations.  If it is exceeded, neither are the
+// matrices propagated nor are stale matrices rebuilt until search caught
+// up again, and extraction itself stops as soon as it hits the limit.
+
+/*------------------------------------------------------------------------*/
+
+inline double Internal::gauss_limit () {
+  return opts.gaussmineff +
+    1e-3 * opts.gaussreleff * stats.propagations.search;
+}
+
+bool Internal::gaussing () {
+  if (!opts.gauss) return false;
+  if (proof) return false;
+  if (!gaussian.stale) return false;
+  return stats.gauss.ticks <= gauss_limit ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Extract XORs of size at most 'opts.gaussxorlim'.  Each XOR is stored as
+// its variables terminated by zero on 'xors' and its parity on 'parities'.
+// Connecting occurrences and searching the shortest occurrence list in
+// 'find_clause' is charged to 'stats.gauss.ticks'.
+
+void Internal::extract_xors (vector<int> & xors, vector<char> & parities) {
+
+  assert (!level);
+  assert (xors.empty ());
+  assert (parities.empty ());
+
+  const int size_limit = opts.gaussxorlim;
+  const double limit = gauss_limit ();
+
+  init_occs ();
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->redundant) continue;
+    if (c->size > size_limit) continue;
+    for (const auto & lit : *c)
+      occs (lit).push_back (c);
+    stats.gauss.ticks += c->size;
+  }
+
+  vector<int> lits;
+  vector<Clause *> found;
+
+  for (const auto & d : clauses) {
+
+    if (stats.gauss.ticks > limit) {
+      LOG ("XOR extraction hit ticks limit");
+      break;
+    }
+
+    if (d->garbage) continue;
+    if (d->redundant) continue;
+    if (d->gate) continue;
+    if (d->size > size_limit) continue;
+    if (!get_clause (d, lits)) continue;
+
+    const int size = lits.size ();
+    if (size < 3) continue;
+
+    unsigned negative = 0;
+    for (const auto & lit : lits)
+      if (lit < 0) negative++;
+
+    unsigned needed = (1u << (size - 1)) - 1;   // additional clauses
+    unsigned signs = 0;                         // literals to negate
+
+    found.clear ();
+    do {
+      const unsigned prev = signs;
+      while (parity (++signs))
+        ;
+      for (int j = 0; j < size; j++) {
+        const unsigned bit = 1u << j;
+        int lit = lits[j];
+        if ((prev & bit) != (signs & bit))
+          lits[j] = lit = -lit;
+      }
+      size_t len = occs (lits[0]).size ();
+      for (const auto & lit : lits)
+        len = min (len, occs (lit).size ());
+      stats.gauss.ticks += 1 + len;
+      Clause * e = find_clause (lits);
+      if (!e) break;
+      found.push_back (e);
+    } while (--needed);
+
+    if (needed) continue;
+
+    // The clause excludes the assignment falsifying all its literals, which
+    // has as many true variables as there are negative literals.
+
+    const int rhs = !(negative & 1);
+    LOG (d, "found XOR with parity %d of size %d", rhs, size);
+    stats.gauss.xors++;
+
+    d->gate = true;
+    for (const auto & e : found)
+      e->gate = true;
+
+    for (const auto & lit : lits)
+      xors.push_back (abs (lit));
+    xors.push_back (0);
+    parities.push_back (rhs);
+  }
+
+  for (const auto & c : clauses)
+    c->gate = false;
+
+  reset_occs ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Bring the matrix into reduced row echelon form.  Rows reduced to zero
+// are removed and if such a row has parity one the formula is unsatisfiable.
+// Rows with a single column are root-level units.
+
+void Internal::reduce_gauss_matrix (GaussMatrix & m) {
+
+  const size_t words = m.words;
+  const size_t num_rows = m.parities.size ();
+  const size_t num_columns = m.vars.size ();
+
+  size_t rank = 0;
+  for (size_t column = 0; rank < num_rows && column < num_columns; column++) {
+    const size_t w = column / 64;
+    const uint64_t bit = (uint64_t) 1 << (column & 63);
+    size_t pivot = rank;
+    while (pivot < num_rows && !(m.row (pivot)[w] & bit))
+      pivot++;
+    if (pivot == num_rows) continue;
+    if (pivot != rank) {
+      uint64_t * p = m.row (pivot), * r = m.row (rank);
+      for (size_t k = 0; k < words; k++)
+        swap (p[k], r[k]);
+      swap (m.parities[pivot], m.parities[rank]);
+    }
+    const uint64_t * r = m.row (rank);
+    for (size_t i = 0; i < num_rows; i++) {
+      if (i == rank) continue;
+      uint64_t * q = m.row (i);
+      if (!(q[w] & bit)) continue;
+      for (size_t k = 0; k < words; k++)
+        q[k] ^= r[k];
+      m.parities[i] ^= m.parities[rank];
+    }
+    stats.gauss.ticks += num_rows;
+    m.pivots.push_back ((int) column);
+    rank++;
+  }
+
+  for (size_t i = rank; !unsat && i < num_rows; i++) {
+    if (!m.parities[i]) continue;
+    LOG ("Gaussian elimination yields inconsistent row");
+    learn_empty_clause ();
+  }
+
+  m.rows.resize (rank * words);
+  m.parities.resize (rank);
+  shrink_vector (m.rows);
+  shrink_vector (m.parities);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Extract XORs and build the reduced matrices of the independent sets of
+// XORs (connected through shared variables).
+
+void Internal::gauss () {
+
+  if (unsat) return;
+  assert (gaussing ());
+
+  START (gauss);
+  stats.gauss.count++;
+
+  backtrack ();
+  gaussian.stale = false;
+  erase_vector (gaussian.matrices);
+
+  if (!propagate ()) {
+    learn_empty_clause ();
+    STOP (gauss);
+    return;
+  }
+
+  // Removing falsified literals shrinks clauses in place, which requires
+  // the watches to be updated by a garbage collection.
+
+  mark_satisfied_clauses_as_garbage ();
+  garbage_collection ();
+
+  vector<int> xors;
+  vector<char> parities;
+  extract_xors (xors, parities);
+
+  // Union-find with path halving over the variables of the XORs.
+
+  vector<int> parent (max_var + 1, 0);
+  auto find = [&parent] (int idx) {
+    while (parent[idx] != idx)
+      idx = parent[idx] = parent[parent[idx]];
+    return idx;
+  };
+  for (auto p = xors.begin (); p != xors.end (); p++) {
+    int root = 0;
+    for (; *p; p++) {
+      const int idx = *p;
+      if (!parent[idx]) parent[idx] = idx;
+      const int other = find (idx);
+      if (!root) root = other;
+      else if (other != root) parent[other] = root;
+    }
+  }
+
+  // Number the matrices by their root variable and collect columns.
+
+  vector<int> matrix (max_var + 1, -1), column (max_var + 1, -1);
+  vector<size_t> rows;
+
+  for (auto p = xors.begin (); p != xors.end (); p++) {
+    int & m = matrix[find (*p)];
+    if (m < 0) {
+      m = (int) gaussian.matrices.size ();
+      gaussian.matrices.push_back (GaussMatrix ());
+      rows.push_back (0);
+    }
+    rows[m]++;
+    GaussMatrix & g = gaussian.matrices[m];
+    for (; *p; p++) {
+      const int idx = *p;
+      if (column[idx] >= 0) continue;
+      column[idx] = (int) g.vars.size ();
+      g.vars.push_back (idx);
+    }
+  }
+
+  const size_t num_matrices = gaussian.matrices.size ();
+  vector<bool> skip (num_matrices, false);
+  for (size_t m = 0; m < num_matrices; m++) {
+    GaussMatrix & g = gaussian.matrices[m];
+    g.words = (g.vars.size () + 63) / 64;
+    if (rows[m] < 2 ||
+        rows[m] * g.words > (size_t) opts.gaussmaxsize) skip[m] = true;
+    else {
+      g.rows.resize (rows[m] * g.words, 0);
+      g.parities.reserve (rows[m]);
+    }
+  }
+
+  // Fill in the rows.
+
+  auto rhs = parities.begin ();
+  for (auto p = xors.begin (); p != xors.end (); p++, rhs++) {
+    const int m = matrix[find (*p)];
+    GaussMatrix & g = gaussian.matrices[m];
+    if (skip[m]) {
+      while (*p) p++;
+      continue;
+    }
+    uint64_t * row = g.row (g.parities.size ());
+    for (; *p; p++) {
+      const int c = column[*p];
+      row[c / 64] |= (uint64_t) 1 << (c & 63);
+    }
+    g.parities.push_back (*rhs);
+  }
+
+  // Reduce the matrices and assign units.
+
+  size_t j = 0, units = 0;
+  for (size_t i = 0; i < num_matrices; i++) {
+    if (skip[i]) continue;
+    GaussMatrix & g = gaussian.matrices[i];
+    reduce_gauss_matrix (g);
+    if (unsat) break;
+    for (size_t r = 0; r < g.size (); r++) {
+      const uint64_t * row = g.row (r);
+      size_t count = 0;
+      for (size_t k = 0; count < 2 && k < g.words; k++)
+        count += __builtin_popcountll (row[k]);
+      if (count != 1) continue;
+      const int idx = g.vars[g.pivots[r]];
+      const int lit = g.parities[r] ? idx : -idx;
+      const signed char tmp = val (lit);
+      if (tmp > 0) continue;
+      if (tmp < 0) { learn_empty_clause (); break; }
+      LOG ("Gaussian elimination yields unit %d", lit);
+      assign_unit (lit);
+      units++;
+    }
+    if (unsat) break;
+    if (g.size () < 2) continue;
+    stats.gauss.rows += g.size ();
+    if (i != j) gaussian.matrices[j] = move (g);
+    j++;
+  }
+  gaussian.matrices.resize (j);
+  stats.gauss.matrices += j;
+  stats.gauss.units += units;
+
+  if (!unsat && units && !propagate ()) learn_empty_clause ();
+  if (unsat) erase_vector (gaussian.matrices);
+
+  PHASE ("gauss", stats.gauss.count,
+    "extracted %zd XORs into %zd matrices with %zd units",
+    parities.size (), j, units);
+
+  STOP (gauss);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Propagate the rows of one matrix under the current assignment (see the
+// explanation at the top of this file).  Returns 'false' if a conflict
+// was found (or the formula became inconsistent) or we backtracked.
+
+bool Internal::gauss_propagate_matrix (GaussMatrix & m) {
+
+  const size_t words = m.words;
+  const size_t num_rows = m.size ();
+  const size_t num_columns = m.vars.size ();
+
+  vector<uint64_t> & unassigned = gaussian.unassigned;
+  vector<uint64_t> & values = gaussian.values;
+
+  unassigned.assign (words, 0);
+  values.assign (words, 0);
+
+  for (size_t c = 0; c < num_columns; c++) {
+    const signed char tmp = val (m.vars[c]);
+    const uint64_t bit = (uint64_t) 1 << (c & 63);
+    if (!tmp) unassigned[c / 64] |= bit;
+    else if (tmp > 0) values[c / 64] |= bit;
+  }
+
+  vector<uint64_t> & rows = gaussian.rows;
+  vector<char> & parities = gaussian.parities;
+  vector<int> & pivots = gaussian.pivots;
+
+  rows = m.rows;
+  parities = m.parities;
+  pivots = m.pivots;
+
+  int64_t ticks = (num_rows + 1) * words + num_columns / 8;
+
+  // Find new pivots for rows with assigned pivot column.
+
+  for (size_t i = 0; i < num_rows; i++) {
+    const int pivot = pivots[i];
+    if (unassigned[pivot / 64] & ((uint64_t) 1 << (pivot & 63))) continue;
+    uint64_t * r = &rows[i * words];
+    int column = -1;
+    for (size_t k = 0; column < 0 && k < words; k++) {
+      const uint64_t candidates = r[k] & unassigned[k];
+      if (candidates)
+        column = 64 * k + __builtin_ctzll (candidates);
+    }
+    pivots[i] = column;
+    if (column < 0) continue;
+    const size_t w = column / 64;
+    const uint64_t bit = (uint64_t) 1 << (column & 63);
+    for (size_t j = 0; j < num_rows; j++) {
+      if (j == i) continue;
+      uint64_t * q = &rows[j * words];
+      if (!(q[w] & bit)) continue;
+      for (size_t k = 0; k < words; k++)
+        q[k] ^= r[k];
+      parities[j] ^= parities[i];
+      ticks += words;
+    }
+    ticks += num_rows;
+  }
+
+  stats.gauss.ticks += ticks;
+
+  // Now look for conflicting and propagating rows.
+
+  for (size_t i = 0; i < num_rows; i++) {
+
+    const uint64_t * r = &rows[i * words];
+    const int pivot = pivots[i];
+
+    int rhs = parities[i];
+    bool unit = true;
+    for (size_t k = 0; k < words; k++) {
+      rhs ^= __builtin_parityll (r[k] & values[k]);
+      uint64_t others = r[k] & unassigned[k];
+      if (pivot >= 0 && (size_t) pivot / 64 == k)
+        others &= ~((uint64_t) 1 << (pivot & 63));
+      if (others) unit = false;
+    }
+    if (!unit) continue;
+    if (pivot < 0 && !rhs) continue;
+
+    // Generate the reason or conflict clause of this row.
+
+    assert (clause.empty ());
+    if (pivot >= 0) {
+      const int idx = m.vars[pivot];
+      clause.push_back (rhs ? idx : -idx);
+    }
+    for (size_t k = 0; k < words; k++) {
+      uint64_t bits = r[k] & ~unassigned[k];
+      while (bits) {
+        const int c = 64 * k + __builtin_ctzll (bits);
+        bits &= bits - 1;
+        const int idx = m.vars[c];
+        if (!var (idx).level) continue;
+        clause.push_back (val (idx) > 0 ? -idx : idx);
+      }
+    }
+
+    if (pivot >= 0) {
+      LOG (clause, "Gaussian elimination propagates %d with", clause[0]);
+      stats.gauss.propagations++;
+    } else {
+      LOG (clause, "Gaussian elimination conflict");
+      stats.gauss.conflicts++;
+    }
+
+    // Units backtrack to the root and are propagated immediately, which
+    // invalidates the assignment masks as does backtracking in general.
+
+    const int before = level;
+    const bool forced_unit = (clause.size () == 1);
+    add_lazy_clause (true);
+    if (conflict || unsat || level < before || forced_unit) return false;
+  }
+
+  return true;
+}
+
+// Propagate all matrices until fixpoint (together with unit propagation).
+// Returns 'false' on a conflict (which then is in 'conflict') or if the
+// formula became inconsistent.
+
+bool Internal::gauss_propagate () {
+
+  if (gaussian.matrices.empty ()) return true;
+  if (gaussian.stale) return true;
+
+  assert (!conflict);
+  assert (!unsat);
+  assert (propagated == trail.size ());
+
+  if (stats.gauss.ticks > gauss_limit ()) return true;
+
+  START (gauss);
+
+  for (;;) {
+    for (auto & m : gaussian.matrices)
+      if (!gauss_propagate_matrix (m))
+        break;
+    if (conflict || unsat) break;
+    if (propagated == trail.size ()) break;
+    if (!propagate ()) break;
+  }
+
+  STOP (gauss);
+
+  return !conflict && !unsat;
+}
+
+}
@@ -0,0 +1,40 @@
+#ifndef _gauss_hpp_INCLUDED
+#define _gauss_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// XOR constraints extracted from the irredundant clauses are partitioned
+// into independent matrices (no shared variables).  Each matrix is kept in
+// reduced row echelon form with rows packed into 64-bit words, which are
+// processed word by word (and thus can be vectorized by the compiler).
+// See 'gauss.cpp' for how these matrices take part in propagation.
+
+struct GaussMatrix {
+  vector<int> vars;             // internal variable of each column
+  vector<int> pivots;           // pivot column of each row
+  vector<uint64_t> rows;        // 'words' words for each row
+  vector<char> parities;        // right hand side of each row
+  size_t words;                 // number of 64-bit words per row
+  GaussMatrix () : words (0) { }
+  size_t size () const { return pivots.size (); }
+  uint64_t * row (size_t i) { return &rows[i * words]; }
+};
+
+struct Gauss {
+  vector<GaussMatrix> matrices; // all non-trivial matrices
+  bool stale;                   // needs to be rebuilt before being used
+
+  // Working copy of one matrix used during propagation.
+
+  vector<uint64_t> rows;        // rows of the current matrix
+  vector<char> parities;        // right hand sides of the current matrix
+  vector<int> pivots;           // current pivot column (or -1) of rows
+  vector<uint64_t> unassigned;  // mask of currently unassigned columns
+  vector<uint64_t> values;      // mask of currently true columns
+
+  Gauss () : stale (true) { }
+};
+
+}
+
+#endif
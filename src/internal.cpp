@@ -28,6 +28,8 @@ Internal::Internal ()
   ignore (0),
   propagated (0),
   propagated2 (0),
+  notified (0),
+  notified_level (0),
   best_assigned (0),
   target_assigned (0),
   no_conflict_until (0),
@@ -199,8 +201,17 @@ int Internal::cdcl_loop_with_inprocessing () {
          if (unsat) res = 20;
     else if (unsat_constraint) res = 20;
     else if (!propagate ()) analyze ();      // propagate and analyze
+    else if (!external_propagate ()) {       // external propagator
+      if (!unsat) analyze ();
+    }
+    else if (!gauss_propagate ()) {          // Gaussian elimination
+      if (!unsat) analyze ();
+    }
+    else if (!card_propagate ()) {           // cardinality constraints
+      if (!unsat) analyze ();
+    }
     else if (iterating) iterate ();          // report learned unit
-    else if (satisfied ()) res = 10;         // found model
+    else if (satisfied ()) res = external_check_model (); // found model
     else if (search_limits_hit ()) break;    // decision or conflict limit
     else if (terminated_asynchronously ())    // externally terminated
       break;
@@ -212,6 +223,8 @@ int Internal::cdcl_loop_with_inprocessing () {
     else if (eliminating ()) elim ();        // variable elimination
     else if (compacting ()) compact ();      // collect variables
     else if (conditioning ()) condition ();  // globally blocked clauses
+    else if (gaussing ()) gauss ();          // extract XOR matrices
+    else if (carding ()) card ();            // derive cardinality constraints
     else res = decide ();                    // next decision
   }
 
@@ -415,6 +428,20 @@ void Internal::init_search_limits () {
       inc.decisions, lim.decisions);
   }
 
+  // Memory limit (the smaller of option and explicit limit).
+
+  {
+    int64_t mb = opts.memlimit;
+    if (inc.memory > 0 && (!mb || inc.memory < mb)) mb = inc.memory;
+    lim.memory = mb << 20;
+    lim.memcheck = stats.conflicts;
+    lim.memflushed = 0;
+    lim.memrechecks = 0;
+    lim.memflush = false;
+    if (mb) LOG ("memory limit of %" PRId64 " MB", mb);
+    else LOG ("no limit on memory");
+  }
+
   /*----------------------------------------------------------------------*/
 
   // Initial preprocessing rounds.
@@ -438,6 +465,7 @@ bool Internal::preprocess_round (int round) {
   (void) round;
   if (unsat) return false;
   if (!max_var) return false;
+  if (level) backtrack ();
   START (preprocess);
   struct { int64_t vars, clauses; } before, after;
   before.vars = active ();
@@ -451,6 +479,7 @@ bool Internal::preprocess_round (int round) {
   int old_elimbound = lim.elimbound;
   if (opts.probe) probe (false);
   if (opts.elim) elim (false);
+  if (opts.bva) bva ();
   if (opts.condition) condition (false);
   after.vars = active ();
   after.clauses = stats.current.irredundant;
@@ -467,7 +496,17 @@ bool Internal::preprocess_round (int round) {
   return false;
 }
 
+// Preprocessing rounds backtrack to the root level anyway, thus we do so
+// before deduplication too.  Otherwise assumption levels kept by
+// 'reuse_assumption_levels' prevent deduplication here, which is fine,
+// since adding original clauses backtracks and thus only learned clauses
+// can have been added since the last 'solve' call.  Those are deduplicated
+// during subsumption in 'subsume'.
+
 int Internal::preprocess () {
+  if (level && lim.preprocessing) backtrack ();
+  if (!level && stats.added.total != last.deduplicate.added)
+    mark_duplicated_clauses_as_garbage ();
   for (int i = 0; i < lim.preprocessing; i++)
     if (!preprocess_round (i))
       break;
@@ -558,6 +597,7 @@ int Internal::local_search () {
   if (!max_var) return 0;
   if (!opts.walk) return 0;
   if (constraint.size ()) return 0;
+  if (external->propagator) return 0;
 
   int res = 0;
 
@@ -585,6 +625,8 @@ int Internal::solve (bool preprocess_only) {
   if (preprocess_only) LOG ("internal solving in preprocessing only mode");
   else LOG ("internal solving in full mode");
   init_report_limits ();
+  gaussian.stale = true;
+  cards.stale = true;
   int res = already_solved ();
   if (!res) res = restore_clauses ();
   if (!res) {
@@ -597,6 +639,7 @@ int Internal::solve (bool preprocess_only) {
     if (!res) res = lucky_phases ();
     if (!res) res = cdcl_loop_with_inprocessing ();
   }
+  if (res == 20) minimize_failed_assumptions ();
   reset_solving ();
   report_solving (res);
   STOP (solve);
@@ -609,7 +652,12 @@ int Internal::already_solved () {
     LOG ("already inconsistent");
     res = 20;
   } else {
-    if (level) backtrack ();
+    if (level) backtrack (lookingahead ? 0 : reuse_assumption_levels ());
+    if (level && !propagate ()) {
+      LOG ("propagating reused assumption levels produces conflict");
+      backtrack ();
+      conflict = 0;
+    }
     if (!propagate ()) {
       LOG ("root level propagation produces conflict");
       learn_empty_clause ();
@@ -650,6 +698,7 @@ int Internal::restore_clauses () {
     LOG ("no tainted literals and nothing to restore");
     report ('*');
   } else {
+    if (level) backtrack ();
     report ('+');
     external->restore_clauses ();
     internal->report ('r');
@@ -684,6 +733,7 @@ int Internal::lookahead () {
 
 void Internal::print_statistics () {
   stats.print (this);
+  print_memory_usage ();
   if (checker) checker->print_stats ();
 }
 
@@ -49,7 +49,9 @@ extern "C" {
 #include "averages.hpp"
 #include "bins.hpp"
 #include "block.hpp"
+#include "bva.hpp"
 #include "cadical.hpp"
+#include "card.hpp"
 #include "checker.hpp"
 #include "clause.hpp"
 #include "config.hpp"
@@ -61,18 +63,22 @@ extern "C" {
 #include "file.hpp"
 #include "flags.hpp"
 #include "format.hpp"
+#include "gauss.hpp"
 #include "heap.hpp"
 #include "instantiate.hpp"
 #include "internal.hpp"
 #include "level.hpp"
 #include "limit.hpp"
 #include "logging.hpp"
+#include "memory.hpp"
 #include "message.hpp"
 #include "observer.hpp"
 #include "occs.hpp"
 #include "options.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
+#include "pool.hpp"
+#include "probe.hpp"
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
@@ -84,8 +90,11 @@ extern "C" {
 #include "resources.hpp"
 #include "score.hpp"
 #include "stats.hpp"
+#include "subsume.hpp"
+#include "sweep.hpp"
 #include "terminal.hpp"
 #include "tracer.hpp"
+#include "unhide.hpp"
 #include "util.hpp"
 #include "var.hpp"
 #include "version.hpp"
@@ -118,20 +127,22 @@ struct Internal {
 
   enum Mode {
     BLOCK    = (1<<0),
-    CONDITION= (1<<1),
-    COVER    = (1<<2),
-    DECOMP   = (1<<3),
-    DEDUP    = (1<<4),
-    ELIM     = (1<<5),
-    LUCKY    = (1<<6),
-    PROBE    = (1<<7),
-    SEARCH   = (1<<8),
-    SIMPLIFY = (1<<9),
-    SUBSUME  = (1<<10),
-    TERNARY  = (1<<11),
-    TRANSRED = (1<<12),
-    VIVIFY   = (1<<13),
-    WALK     = (1<<14),
+    BVA      = (1<<1),
+    CONDITION= (1<<2),
+    COVER    = (1<<3),
+    DECOMP   = (1<<4),
+    DEDUP    = (1<<5),
+    ELIM     = (1<<6),
+    LUCKY    = (1<<7),
+    PROBE    = (1<<8),
+    SEARCH   = (1<<9),
+    SIMPLIFY = (1<<10),
+    SUBSUME  = (1<<11),
+    TERNARY  = (1<<12),
+    TRANSRED = (1<<13),
+    UNHIDE   = (1<<14),
+    VIVIFY   = (1<<15),
+    WALK     = (1<<16),
   };
 
   bool in_mode (Mode m) const { return (mode & m) != 0; }
@@ -172,6 +183,7 @@ struct Internal {
   vector<Flags> ftab;           // variable and literal flags
   vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
+  Pool pool;                    // memory of 'otab' and 'big' lists
   vector<Occs> otab;            // table of occurrences for all literals
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
@@ -181,6 +193,8 @@ struct Internal {
   Clause * ignore;              // ignored during 'vivify_propagate'
   size_t propagated;            // next trail position to propagate
   size_t propagated2;           // next binary trail position to propagate
+  size_t notified;              // next trail position to notify externally
+  int notified_level;           // decision level notified externally
   size_t best_assigned;         // best maximum assigned ever
   size_t target_assigned;       // maximum assigned without conflict
   size_t no_conflict_until;     // largest trail prefix without conflict
@@ -196,6 +210,8 @@ struct Internal {
   vector<int> minimized;        // removable or poison in 'minimize'
   vector<int> shrinkable;       // removable or poison in 'shrink'
   Reap reap;                    // radix heap for shrink
+  Gauss gaussian;               // Gauss-Jordan elimination of XORs
+  Cards cards;                  // derived cardinality constraints
 
   vector<int> probes;           // remaining scheduled probes
   vector<Level> control;        // 'level + 1 == control.size ()'
@@ -536,6 +552,7 @@ struct Internal {
   void unassign (int lit);
   void update_target_and_best ();
   void backtrack (int target_level = 0);
+  void probe_backtrack (size_t assigned);
 
   // Minimized learned clauses in 'minimize.cpp'.
   //
@@ -611,6 +628,11 @@ struct Internal {
 
   bool search_limits_hit ();
 
+  // Reacting to a memory limit in 'memlimit.cpp'.
+  //
+  void shrink_memory ();
+  bool memory_limit_hit ();
+
   void terminate () {
     LOG ("forcing asynchronous termination");
     termination_forced = true;
@@ -645,7 +667,9 @@ struct Internal {
   void check_clause_stats ();
   void check_var_stats ();
   bool arenaing ();
+  bool moving_garbage_collection ();
   void garbage_collection ();
+  void collect_retracted ();
 
   // Set-up occurrence list counters and containers.
   //
@@ -656,6 +680,10 @@ struct Internal {
   void reset_bins ();
   void reset_noccs ();
 
+  // Snapshot of the binary implication graph in 'bins.cpp'.
+  //
+  void init_bin_graph (BinGraph &, bool redundant);
+
   // Operators on watches.
   //
   void init_watches ();
@@ -670,11 +698,19 @@ struct Internal {
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause * subsuming, Clause * subsumed);
   int subsume_check (Clause * subsuming, Clause * subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause*> & shrunken);
+  uint64_t subsume_signature (Clause *);
+  int try_to_subsume_clause (Clause *, uint64_t sig,
+                             vector<SubsumeWatches> & watched,
+                             vector<Clause*> & shrunken);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
 
+  // Hash based removal of duplicated clauses in 'deduplicate.cpp'.
+  //
+  uint64_t dedup_hash (Clause *);
+  void mark_duplicated_clauses_as_garbage ();
+
   // Covered clause elimination of large clauses.
   //
   void covered_literal_addition (int lit, Coveror &);
@@ -710,6 +746,17 @@ struct Internal {
   //
   void transred ();
 
+  // Unhiding through time stamps of the binary implication graph in
+  // 'unhide.cpp'.
+  //
+  void unhide_stamp (Unhider &, int start);
+  void unhide_stamp_all (Unhider &);
+  bool unhide_implies (Unhider &, int a, int b);
+  bool unhide_hte (Unhider &, Clause *, vector<int> &, vector<int> &);
+  void unhide_hle (Unhider &, Clause *, vector<int> &, vector<int> &);
+  void unhide_round ();
+  void unhide ();
+
   // We monitor the maximum size and glue of clauses during 'reduce' and
   // thus can predict if a redundant extended clause is likely to be kept in
   // the next 'reduce' phase.  These clauses are target of subsumption and
@@ -886,6 +933,26 @@ struct Internal {
     bool ternary_round(int64_t & steps, int64_t & htrs);
     bool ternary();
 
+    // Bounded variable addition in 'bva.cpp'.
+    //
+    int bva_least_occurring_literal(Clause *, int lit);
+    Clause *bva_find_matching_clause(Clause *, int lit, int other);
+    void bva_add_clause(BVASchedule &);
+    void bva_remove_clause(BVASchedule &, Clause *);
+    void bva_replace(BVASchedule &, int lit, const vector<int> &lits,
+                     const vector<Clause *> &matched);
+    void bva_lit(BVASchedule &, int lit, int64_t &ticks, int64_t limit);
+    void bva();
+
+    // Random simulation sweeping in 'sweep.cpp'.
+    //
+    void sweep_extract_gates(Sweeper &, int64_t limit);
+    void sweep_simulate(Sweeper &);
+    void sweep_add_binary(int, int);
+    void sweep_constant(int lit);
+    void sweep_equivalences(const vector<int> &lits);
+    bool sweep();
+
     // Probing in 'probe.cpp'.
     //
     bool probing();
@@ -904,15 +971,16 @@ struct Internal {
     void generate_probes();
     void flush_probes();
     int next_probe();
+    void probe_forest_insert(ProbeForest &, int probe);
+    void probe_tree(ProbeForest &, int probe, int64_t limit);
     bool probe_round();
     void probe(bool update_limits = true);
 
     // ProbSAT/WalkSAT implementation called initially or from 'rephase'.
     //
     void walk_save_minimum(Walker &);
-    Clause *walk_pick_clause(Walker &);
-    unsigned walk_break_value(int lit);
-    int walk_pick_lit(Walker &, Clause *);
+    unsigned walk_pick_clause(Walker &);
+    int walk_pick_lit(Walker &, unsigned);
     void walk_flip_lit(Walker &, int lit);
     int walk_round(int64_t limit, bool prev);
     void walk();
@@ -931,6 +999,44 @@ struct Internal {
     bool failed(int lit);     // Literal failed assumption?
     void reset_assumptions(); // Reset after 'solve' call.
     void failing();           // Prepare failed assumptions.
+    int reuse_assumption_levels(); // Assumption levels kept in 'solve'.
+
+    // Minimizing failed assumptions in 'coremin.cpp'.
+    //
+    size_t propagate_core(const vector<int> &);
+    int search_core(int64_t conflicts);
+    void minimize_failed_assumptions();
+
+    // Connecting external propagators in 'propagator.cpp'.
+    //
+    void notify_assignments();
+    int internalize_observed(int elit);
+    void add_external_clause(bool redundant);
+    void add_lazy_clause(bool redundant);
+    bool external_propagate();
+    int external_check_model();
+
+    // Gauss-Jordan elimination of XOR constraints in 'gauss.cpp'.
+    //
+    bool gaussing();
+    double gauss_limit();
+    void extract_xors(vector<int> &xors, vector<char> &parities);
+    void reduce_gauss_matrix(GaussMatrix &);
+    void gauss();
+    bool gauss_propagate_matrix(GaussMatrix &);
+    bool gauss_propagate();
+
+    // Cardinality constraint reasoning in 'card.cpp'.
+    //
+    bool carding();
+    double card_limit();
+    void find_amo_constraints(vector<Card> &);
+    bool resolve_cards(const Card &, const Card &, int pivot, Card &);
+    void eliminate_cards(vector<Card> &, vector<int> &units);
+    void card();
+    void propagate_card(Card &);
+    bool card_propagate();
+    void card_backtrack(size_t assigned);
 
     bool assumed(int lit) {   // Marked as assumption.
       Flags &f = flags(lit);
@@ -984,6 +1090,7 @@ struct Internal {
     void limit_conflicts(int);     // Force conflict limit.
     void limit_preprocessing(int); // Enable 'n' preprocessing rounds.
     void limit_local_search(int);  // Enable 'n' local search rounds.
+    void limit_memory(int);        // Force memory limit in MB.
 
     // External versions can access limits by 'name'.
     //
@@ -1156,6 +1263,12 @@ struct Internal {
   void print_statistics ();
   void print_resource_usage ();
 
+  // Accounting allocated memory of data structures in 'memory.cpp'.
+  //
+  void memory_usage (Memory &);
+  int64_t memory_usage (const char * name);   // negative if invalid
+  void print_memory_usage ();
+
   /*----------------------------------------------------------------------*/
 
 #ifndef QUIET
@@ -1261,6 +1374,7 @@ inline int External::fixed (int elit) const {
   assert (elit != INT_MIN);
   int eidx = abs (elit);
   if (eidx > max_var) return 0;
+  if (hidden (eidx)) return 0;
   int ilit = e2i [eidx];
   if (!ilit) return 0;
   if (elit < 0) ilit = -ilit;
@@ -1347,6 +1461,13 @@ inline bool Internal::search_limits_hit ()
     return true;
   }
 
+  if (lim.memory > 0 &&
+      stats.conflicts >= lim.memcheck &&
+      memory_limit_hit ()) {
+    LOG ("memory limit %" PRId64 " bytes reached", lim.memory);
+    return true;
+  }
+
   return false;
 }
 
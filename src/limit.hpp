@@ -11,11 +11,13 @@ struct Limit {
   int64_t decisions;       // decision limit if non-negative
   int64_t preprocessing;   // limit on preprocessing rounds
   int64_t localsearch;     // limit on local search rounds
+  int64_t memory;          // memory limit in bytes if positive
 
   int64_t compact;         // conflict limit for next 'compact'
   int64_t condition;       // conflict limit for next 'condition'
   int64_t elim;            // conflict limit for next 'elim'
   int64_t flush;           // conflict limit for next 'flush'
+  int64_t memcheck;        // conflict limit for next memory check
   int64_t probe;           // conflict limit for next 'probe'
   int64_t reduce;          // conflict limit for next 'reduce'
   int64_t rephase;         // conflict limit for next 'rephase'
@@ -40,6 +42,14 @@ struct Limit {
     int forced;            // forced termination for testing
   } terminate;
 
+  // Internally accounted memory before flushing to meet the memory limit
+  // (zero if not flushed), the number of checks since flushing and whether
+  // the next 'reduce' has to flush (even if 'flush' is disabled).
+  //
+  int64_t memflushed;
+  int memrechecks;
+  bool memflush;
+
   Limit ();
 };
 
@@ -50,6 +60,7 @@ struct Last {
   struct { int64_t conflicts; } reduce, rephase;
   struct { int64_t marked; } ternary;
   struct { int64_t fixed; } collect;
+  struct { int64_t added; } deduplicate;
   Last ();
 };
 
@@ -60,6 +71,7 @@ struct Inc {
   int64_t decisions;       // next decision limit if non-negative
   int64_t preprocessing;   // next preprocessing limit if non-negative
   int64_t localsearch;     // next local search limit if non-negative
+  int64_t memory;          // next memory limit in MB if positive
   Inc ();
 };
 
@@ -271,15 +271,22 @@ int Internal::negative_horn_satisfiable () {
 /*------------------------------------------------------------------------*/
 
 int Internal::lucky_phases () {
-  assert (!level);
   require_mode (SEARCH);
   if (!opts.lucky) return 0;
 
+  // Lucky assignments are not checked by external propagators.
+  //
+  if (external->propagator) return 0;
+
   // TODO: Some of the lucky assignments can also be found if there are
   // assumptions, but this is not completely implemented nor tested yet.
   // Nothing done for constraint either.
   if (!assumptions.empty () || !constraint.empty ()) return 0;
 
+  // Assumption levels are only kept if there are assumptions.
+  //
+  assert (!level);
+
   START (search);
   START (lucky);
   assert (!searching_lucky_phases);
@@ -0,0 +1,107 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Checking the memory limit set by '--memlimit' or 'limit ("memory", ...)'.
+// Every 'memlimitint' conflicts the current resident set size is compared
+// to the limit.  If it is close (above 80%) we force a 'reduce' to collect
+// useless learned clauses.  If it is exceeded we force a 'flush' of all
+// (unused) learned clauses which also triggers a garbage collection,
+// which in turn shrinks the watch lists and the clause stack.
+//
+// The memory is checked again right after the flush.  However, the memory
+// allocator rarely returns freed memory to the operating system and thus
+// the resident set size usually does not drop.  Therefore we compare the
+// internally accounted memory (see 'memory.cpp'), which includes all slabs
+// of the occurrence and graph pool, to the one before the flush instead
+// and keep searching as long as it stays below, but at most for
+// 'memlimittries' further checks.  Otherwise the search is stopped and
+// 'solve' returns zero (unknown) just like for the other search limits.
+
+// Release excess capacity of the clause stack, watch lists and the
+// temporary vectors used in conflict analysis.  Garbage collection only
+// shrinks the watch lists it flushes and the clause stack if it became
+// less than half full.  The pool slabs are not released by flushing but
+// only if no occurrence or graph list is allocated any more.
+
+void Internal::shrink_memory () {
+  pool.release ();
+  shrink_vector (clauses);
+  if (watching ())
+    for (auto & ws : wtab)
+      shrink_vector (ws);
+  shrink_vector (clause);
+  shrink_vector (levels);
+  shrink_vector (analyzed);
+  shrink_vector (minimized);
+}
+
+bool Internal::memory_limit_hit () {
+
+  assert (lim.memory > 0);
+  stats.memlimit.checks++;
+
+  const int64_t rss = current_resident_set_size ();
+  lim.memcheck = stats.conflicts + opts.memlimitint;
+
+  if (rss <= 0) return false;           // not supported
+
+  LOG ("resident set size %" PRId64 " bytes %.0f%% of memory limit",
+    rss, percent (rss, lim.memory));
+
+  if (rss > lim.memory) {
+
+    if (lim.memflushed) shrink_memory ();
+
+    Memory m;
+    memory_usage (m);
+    const int64_t used = m.total ();
+
+    if (lim.memflushed) {
+
+      if (used < lim.memflushed &&
+          lim.memrechecks < opts.memlimittries) {
+        lim.memrechecks++;
+        VERBOSE (2,
+          "accounted memory %.0f MB below %.0f MB before flushing "
+          "(check %d of %d)",
+          used / (double) (1l << 20), lim.memflushed / (double) (1l << 20),
+          lim.memrechecks, opts.memlimittries);
+        return false;
+      }
+
+      stats.memlimit.exhausted++;
+      VERBOSE (1,
+        "resident set size %.0f MB still exceeds memory limit %.0f MB",
+        rss / (double) (1l << 20), lim.memory / (double) (1l << 20));
+      return true;
+    }
+
+    stats.memlimit.flushes++;
+    VERBOSE (2,
+      "resident set size %.0f MB exceeds memory limit %.0f MB (flushing)",
+      rss / (double) (1l << 20), lim.memory / (double) (1l << 20));
+
+    lim.reduce = stats.conflicts;
+    lim.memflush = true;
+    lim.memcheck = stats.conflicts + 1;         // check after flushing
+    lim.memflushed = max (used, (int64_t) 1);
+    lim.memrechecks = 0;
+
+  } else if (rss > lim.memory / 10 * 8) {
+
+    stats.memlimit.reductions++;
+    VERBOSE (3,
+      "resident set size %.0f MB close to memory limit %.0f MB (reducing)",
+      rss / (double) (1l << 20), lim.memory / (double) (1l << 20));
+
+    lim.reduce = stats.conflicts;
+
+  } else lim.memflushed = 0;
+
+  return false;
+}
+
+}
@@ -0,0 +1,95 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Accounting of the memory allocated by the major data structures.  This
+// is computed on demand by traversing these data structures (and thus
+// takes time linear in the number of clauses and variables) but does not
+// need any bookkeeping during solving (except for checker clauses).
+
+size_t Checker::bytes () const {
+  size_t res = bytes_clauses;
+  res += size_clauses * sizeof (CheckerClause *);
+  res += 2 * size_vars * sizeof (signed char);
+  res += bytes_vector (watchers);
+  for (const auto & ws : watchers)
+    res += bytes_vector (ws);
+  res += bytes_vector (marks);
+  res += bytes_vector (unsimplified);
+  res += bytes_vector (simplified);
+  res += bytes_vector (trail);
+  return res;
+}
+
+size_t Proof::bytes () const {
+  size_t res = bytes_vector (clause);
+  res += bytes_vector (observers);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::memory_usage (Memory & m) {
+
+  m.arena = arena.capacity ();
+
+  m.clauses = bytes_vector (clauses);
+  for (const auto & c : clauses)
+    if (!arena.contains (c))
+      m.clauses += c->bytes ();
+
+  m.watches = bytes_vector (wtab);
+  for (const auto & ws : wtab)
+    m.watches += bytes_vector (ws);
+
+  m.occs = bytes_vector (otab);
+  m.big = bytes_vector (big);
+  m.pool = pool.bytes ();
+
+  m.extension = bytes_vector (external->extension);
+  m.extension += bytes_vector (external->witness);
+
+  m.checker = checker ? checker->bytes () : 0;
+  m.proof = proof ? proof->bytes () : 0;
+}
+
+int64_t Internal::memory_usage (const char * name) {
+  Memory m;
+  memory_usage (m);
+  if (!strcmp (name, "arena")) return m.arena;
+  if (!strcmp (name, "clauses")) return m.clauses;
+  if (!strcmp (name, "watches")) return m.watches;
+  if (!strcmp (name, "occs")) return m.occs;
+  if (!strcmp (name, "big")) return m.big;
+  if (!strcmp (name, "pool")) return m.pool;
+  if (!strcmp (name, "extension")) return m.extension;
+  if (!strcmp (name, "checker")) return m.checker;
+  if (!strcmp (name, "proof")) return m.proof;
+  if (!strcmp (name, "total")) return m.total ();
+  return -1;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::print_memory_usage () {
+#ifndef QUIET
+  Memory m;
+  memory_usage (m);
+  const int64_t t = m.total ();
+  SECTION ("memory usage");
+  MSG ("arena:           %15" PRId64 "   %10.2f %%  bytes", m.arena, percent (m.arena, t));
+  MSG ("clauses:         %15" PRId64 "   %10.2f %%  bytes", m.clauses, percent (m.clauses, t));
+  MSG ("watches:         %15" PRId64 "   %10.2f %%  bytes", m.watches, percent (m.watches, t));
+  MSG ("occs:            %15" PRId64 "   %10.2f %%  bytes", m.occs, percent (m.occs, t));
+  MSG ("big:             %15" PRId64 "   %10.2f %%  bytes", m.big, percent (m.big, t));
+  MSG ("pool:            %15" PRId64 "   %10.2f %%  bytes", m.pool, percent (m.pool, t));
+  MSG ("extension:       %15" PRId64 "   %10.2f %%  bytes", m.extension, percent (m.extension, t));
+  MSG ("checker:         %15" PRId64 "   %10.2f %%  bytes", m.checker, percent (m.checker, t));
+  MSG ("proof:           %15" PRId64 "   %10.2f %%  bytes", m.proof, percent (m.proof, t));
+  MSG ("total:           %15" PRId64 "   %10.2f MB", t, t / (double) (1l << 20));
+#endif
+}
+
+}
@@ -0,0 +1,33 @@
+#ifndef _memory_hpp_INCLUDED
+#define _memory_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Bytes currently allocated by the major data structures of the solver as
+// computed by 'Internal::memory_usage' in 'memory.cpp'.  This accounts for
+// the allocated capacity of vectors and not just their size.  Clauses
+// which reside in the arena are part of 'arena' and not of 'clauses'.  The
+// lists of 'occs' and 'big' are allocated from a pool and only their
+// tables are counted there, while the pool is accounted as a whole
+// including slab overhead, size class rounding and free blocks.
+
+struct Memory {
+  int64_t arena;        // arena of the moving garbage collector
+  int64_t clauses;      // heap allocated clauses and clause stack
+  int64_t watches;      // watch lists
+  int64_t occs;         // occurrence lists
+  int64_t big;          // binary implication graph
+  int64_t pool;         // pool of occurrence lists and graph
+  int64_t extension;    // extension stack with witness
+  int64_t checker;      // internal proof checker
+  int64_t proof;        // proof observer clause buffers
+  int64_t total () const {
+    return arena + clauses + watches + occs + big + pool + extension +
+           checker + proof;
+  }
+  Memory () { memset (this, 0, sizeof *this); }
+};
+
+}
+
+#endif
@@ -455,12 +455,16 @@ struct Call {
 
     CONSTRAIN    = (1<<25),
 
+    GROUP       = (1<<26),
+
+    BACKBONE    = (1<<27),
+
     ALWAYS = VARS | ACTIVE | REDUNDANT | IRREDUNDANT | FREEZE | FROZEN | MELT |
              LIMIT | OPTIMIZE | DUMP | STATS | RESERVE | FIXED,
 
     CONFIG = INIT | SET | CONFIGURE | ALWAYS,
-    BEFORE = ADD | CONSTRAIN | ASSUME | ALWAYS,
-    PROCESS = SOLVE | SIMPLIFY | LOOKAHEAD | CUBING,
+    BEFORE = ADD | CONSTRAIN | ASSUME | GROUP | ALWAYS,
+    PROCESS = SOLVE | SIMPLIFY | LOOKAHEAD | CUBING | BACKBONE,
     AFTER = VAL | FAILED | ALWAYS,
   };
 
@@ -613,6 +617,30 @@ struct ConstrainCall : public Call {
   const char * keyword () { return "constrain"; }
 };
 
+struct OpenGroupCall : public Call {
+  OpenGroupCall () : Call (GROUP) { }
+  void execute (Solver * & s) { res = s->open_group (); }
+  void print (ostream & o) { o << "opengroup" << endl; }
+  Call * copy () { return new OpenGroupCall (); }
+  const char * keyword () { return "opengroup"; }
+};
+
+struct CloseGroupCall : public Call {
+  CloseGroupCall () : Call (GROUP) { }
+  void execute (Solver * & s) { s->close_group (); }
+  void print (ostream & o) { o << "closegroup" << endl; }
+  Call * copy () { return new CloseGroupCall (); }
+  const char * keyword () { return "closegroup"; }
+};
+
+struct RetractGroupCall : public Call {
+  RetractGroupCall (int g) : Call (GROUP, g) { }
+  void execute (Solver * & s) { s->retract_group (arg); }
+  void print (ostream & o) { o << "retractgroup " << arg << endl; }
+  Call * copy () { return new RetractGroupCall (arg); }
+  const char * keyword () { return "retractgroup"; }
+};
+
 struct AssumeCall : public Call {
   AssumeCall (int l) : Call (ASSUME, l) { }
   void execute (Solver * & s) { s->assume (arg); }
@@ -645,6 +673,17 @@ struct LookaheadCall : public Call {
   const char * keyword () { return "lookahead"; }
 };
 
+struct BackboneCall : public Call {
+  BackboneCall (int r = 0) : Call (BACKBONE, 0, r) { }
+  void execute (Solver * & s) {
+    std::vector<int> lits;
+    res = s->backbone (lits);
+  }
+  void print (ostream & o) { o << "backbone " << res << endl; }
+  Call * copy () { return new BackboneCall (res); }
+  const char * keyword () { return "backbone"; }
+};
+
 struct CubingCall : public Call {
   CubingCall(int r = 1) : Call(CUBING, 0, r) {}
   void execute(Solver *&s) { (void)s->generate_cubes(arg); }
@@ -1333,6 +1372,7 @@ void Trace::generate_process (Random & random) {
     push_back(new CubingCall(depth));
   }
   else if (fraction > 0.9) push_back (new LookaheadCall ());
+  else if (fraction > 0.85) push_back (new BackboneCall ());
   else {
     const int rounds = random.pick_int (0, 10);
     push_back (new SimplifyCall (rounds));
@@ -1803,6 +1843,7 @@ static bool is_basic (Call * c) {
     case Call::SIMPLIFY:
     case Call::LOOKAHEAD:
     case Call::CUBING:
+    case Call::BACKBONE:
     case Call::VARS:
     case Call::ACTIVE:
     case Call::REDUNDANT:
@@ -2367,6 +2408,15 @@ void Reader::parse () {
       assert (!second);
       c = new CubingCall (lit);
       solved++;
+    } else if (!strcmp (keyword, "backbone")) {
+      if (first && !parse_int_str (first, lit))
+        error ("invalid argument '%s' to 'backbone'", first);
+      if (first && lit != 0 && lit != 10 && lit != 20)
+        error ("invalid result argument '%d' to 'backbone'", lit);
+      assert (!second);
+      if (first) c = new BackboneCall (lit);
+      else       c = new BackboneCall ();
+      solved++;
     } else if (!strcmp (keyword, "val")) {
       if (!first) error ("first argument to 'val' missing");
       if (!parse_int_str (first, lit))
@@ -2446,6 +2496,25 @@ void Reader::parse () {
       error("additional argument '%s' to 'stats'", first);
     c = new StatsCall();
   }
+  else if (!strcmp(keyword, "opengroup")) {
+    if (first)
+      error("additional argument '%s' to 'opengroup'", first);
+    c = new OpenGroupCall();
+  }
+  else if (!strcmp(keyword, "closegroup")) {
+    if (first)
+      error("additional argument '%s' to 'closegroup'", first);
+    c = new CloseGroupCall();
+  }
+  else if (!strcmp(keyword, "retractgroup")) {
+    if (!first)
+      error("argument to 'retractgroup' missing");
+    if (!parse_int_str(first, lit))
+      error("invalid argument '%s' to 'retractgroup'", first);
+    if (second)
+      error("additional argument '%s' to 'retractgroup'", second);
+    c = new RetractGroupCall(lit);
+  }
   else if (!strcmp(keyword, "reset")) {
     if (first)
       error("additional argument '%s' to 'reset'", first);
@@ -2492,6 +2561,7 @@ void Reader::parse () {
 
     case Call::ADD:
     case Call::ASSUME:
+    case Call::GROUP:
       if (state != Call::BEFORE)
         before_trigger = c;
       new_state = Call::BEFORE;
@@ -2508,7 +2578,7 @@ void Reader::parse () {
       }
       assert(state == Call::SOLVE || state == Call::SIMPLIFY ||
              state == Call::LOOKAHEAD || state == Call::CUBING ||
-             state == Call::AFTER);
+             state == Call::BACKBONE || state == Call::AFTER);
       new_state = Call::AFTER;
       break;
 
@@ -2516,6 +2586,7 @@ void Reader::parse () {
     case Call::SIMPLIFY:
     case Call::LOOKAHEAD:
     case Call::CUBING:
+    case Call::BACKBONE:
     case Call::RESET:
       new_state = c->type;
       break;
@@ -8,13 +8,14 @@ namespace CaDiCaL {
 
 void Internal::init_occs () {
   if (otab.size () < 2*vsize)
-    otab.resize (2*vsize, Occs ());
+    otab.resize (2*vsize, Occs (PoolAllocator<Clause*> (&pool)));
   LOG ("initialized occurrence lists");
 }
 
 void Internal::reset_occs () {
   assert (occurring ());
   erase_vector (otab);
+  pool.release ();
   LOG ("reset occurrence lists");
 }
 
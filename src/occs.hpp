@@ -1,6 +1,8 @@
 #ifndef _occs_h_INCLUDED
 #define _occs_h_INCLUDED
 
+#include "pool.hpp"
+
 #include <vector>
 
 namespace CaDiCaL {
@@ -11,7 +13,7 @@ namespace CaDiCaL {
 struct Clause;
 using namespace std;
 
-typedef vector<Clause*> Occs;
+typedef vector<Clause*, PoolAllocator<Clause*> > Occs;
 
 inline void shrink_occs (Occs & os) { shrink_vector (os); }
 inline void erase_occs (Occs & os) { erase_vector (os); }
@@ -21,8 +21,12 @@
 \
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
+OPTION( arenaminor,       50,  0,100,0,0,1, "minor collection limit in percent") \
+OPTION( arenammap,         1,  0,  1,0,0,1, "map large arenas with huge pages") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
+OPTION( assumereusetrail,  1,  0,  1,0,0,1, "reuse assumption levels") \
+OPTION( backbonechunk,    32,  1,1e5,0,0,1, "backbone candidates per call") \
 OPTION( binary,            1,  0,  1,0,0,1, "use binary proof format") \
 OPTION( block,             0,  0,  1,0,1,1, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
@@ -31,6 +35,17 @@ OPTION( blockocclim,     1e2,  1,2e9,2,0,1, "occurrence limit") \
 OPTION( bump,              1,  0,  1,0,0,1, "bump variables") \
 OPTION( bumpreason,        1,  0,  1,0,0,1, "bump reason literals too") \
 OPTION( bumpreasondepth,   1,  1,  3,0,0,1, "bump reason depth") \
+OPTION( bva,               1,  0,  1,0,1,1, "bounded variable addition") \
+OPTION( bvaclslim,       1e2,  2,2e9,2,0,1, "maximum clause size") \
+OPTION( bvamaxeff,       1e8,  0,2e9,1,0,1, "maximum addition efficiency") \
+OPTION( bvamineff,       1e7,  0,2e9,1,0,1, "minimum addition efficiency") \
+OPTION( bvareleff,       1e3,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( card,              0,  0,  1,0,0,1, "cardinality constraint reasoning") \
+OPTION( cardcllim,        32,  2,1e3,1,0,1, "maximum clause size") \
+OPTION( cardmaxres,      1e5,  1,2e9,1,0,1, "maximum resolvents per round") \
+OPTION( cardmaxsize,     1e3,  2,1e5,1,0,1, "maximum constraint size") \
+OPTION( cardmineff,      1e6,  0,2e9,1,0,1, "minimum cardinality efficiency") \
+OPTION( cardreleff,      1e3,  1,1e6,1,0,1, "relative efficiency per mille") \
 OPTION( check,             0,  0,  1,0,0,0, "enable internal checking") \
 OPTION( checkassumptions,  1,  0,  1,0,0,0, "check assumptions satisfied") \
 OPTION( checkconstraint,   1,  0,  1,0,0,0, "check constraint satisfied") \
@@ -52,6 +67,8 @@ OPTION( conditionmaxeff, 1e7,  0,2e9,1,0,1, "maximum condition efficiency") \
 OPTION( conditionmaxrat, 100,  1,2e9,1,0,1, "maximum clause variable ratio") \
 OPTION( conditionmineff, 1e6,  0,2e9,1,0,1, "minimum condition efficiency") \
 OPTION( conditionreleff, 100,  1,1e5,0,0,1, "relative efficiency per mille") \
+OPTION( coremin,           0,  0,  2,0,0,1, "minimize failed cores (2=search)") \
+OPTION( coreminconflicts,1e2,  0,2e9,0,0,1, "conflicts per core search test") \
 OPTION( cover,             0,  0,  1,0,1,1, "covered clause elimination") \
 OPTION( covermaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( covermaxeff,     1e8,  0,2e9,1,0,1, "maximum cover efficiency") \
@@ -60,7 +77,7 @@ OPTION( covermineff,     1e6,  0,2e9,1,0,1, "minimum cover efficiency") \
 OPTION( coverreleff,       4,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( decompose,         1,  0,  1,0,1,1, "decompose BIG in SCCs and ELS") \
 OPTION( decomposerounds,   2,  1, 16,1,0,1, "number of decompose rounds") \
-OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated binaries") \
+OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated clauses") \
 OPTION( eagersubsume,      1,  0,  1,0,0,1, "subsume recently learned") \
 OPTION( eagersubsumelim,  20,  1,1e3,0,0,1, "limit on subsumed candidates") \
 OPTION( elim,              1,  0,  1,0,1,1, "bounded variable elimination") \
@@ -94,6 +111,11 @@ OPTION( flush,             0,  0,  1,0,0,1, "flush redundant clauses") \
 OPTION( flushfactor,       3,  1,1e3,0,0,1, "interval increase") \
 OPTION( flushint,        1e5,  1,2e9,0,0,1, "initial limit") \
 OPTION( forcephase,        0,  0,  1,0,0,1, "always use initial phase") \
+OPTION( gauss,             0,  0,  1,0,0,1, "Gauss-Jordan elimination of XORs") \
+OPTION( gaussmaxsize,    1e5,  1,2e9,1,0,1, "maximum matrix size in words") \
+OPTION( gaussmineff,     1e6,  0,2e9,1,0,1, "minimum Gauss efficiency") \
+OPTION( gaussreleff,     1e4,  1,1e6,1,0,1, "relative efficiency per mille") \
+OPTION( gaussxorlim,       5,  3, 20,1,0,1, "maximum extracted XOR size") \
 OPTION( inprocessing,      1,  0,  1,0,0,1, "enable inprocessing") \
 OPTION( instantiate,       0,  0,  1,0,1,1, "variable instantiation") \
 OPTION( instantiateclslim, 3,  2,2e9,0,0,1, "minimum clause size") \
@@ -102,6 +124,9 @@ OPTION( instantiateonce,   1,  0,  1,0,0,1, "instantiate each clause once") \
 LOGOPT( log,               0,  0,  1,0,0,0, "enable logging") \
 LOGOPT( logsort,           0,  0,  1,0,0,0, "sort logged clauses") \
 OPTION( lucky,             1,  0,  1,0,0,1, "search for lucky phases") \
+OPTION( memlimit,          0,  0,2e9,0,0,1, "memory limit in MB (0=none)") \
+OPTION( memlimitint,     1e3,  1,2e9,0,0,1, "memory check interval") \
+OPTION( memlimittries,     3,  0,1e3,0,0,1, "memory checks after flushing") \
 OPTION( minimize,          1,  0,  1,0,0,1, "minimize learned clauses") \
 OPTION( minimizedepth,   1e3,  0,1e3,0,0,1, "minimization depth") \
 OPTION( phase,             1,  0,  1,0,0,1, "initial phase") \
@@ -112,6 +137,7 @@ OPTION( probemaxeff,     1e8,  0,2e9,1,0,1, "maximum probing efficiency") \
 OPTION( probemineff,     1e6,  0,2e9,1,0,1, "minimum probing efficiency") \
 OPTION( probereleff,      20,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( proberounds,       1,  1, 16,1,0,1, "probing rounds" ) \
+OPTION( probetree,         1,  0,  1,0,0,1, "tree based probing") \
 OPTION( profile,           2,  0,  4,0,0,0, "profiling level") \
 QUTOPT( quiet,             0,  0,  1,0,0,0, "disable all messages") \
 OPTION( radixsortlim,    800,  0,2e9,0,0,1, "radix sort limit") \
@@ -159,6 +185,12 @@ OPTION( subsumemineff,   1e6,  0,2e9,1,0,1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9,1,0,1, "watch list length limit") \
 OPTION( subsumereleff,   1e3,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( subsumestr,        1,  0,  1,0,0,1, "strengthen during subsume") \
+OPTION( sweep,             1,  0,  1,0,1,1, "random simulation sweeping") \
+OPTION( sweepclslim,      16,  3,1e3,1,0,1, "maximum gate clause size") \
+OPTION( sweepmaxeff,     1e7,  0,2e9,1,0,1, "maximum sweeping efficiency") \
+OPTION( sweepmineff,     1e5,  0,2e9,1,0,1, "minimum sweeping efficiency") \
+OPTION( sweepreleff,      20,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( sweepwords,        4,  1, 64,0,0,1, "simulation words per variable") \
 OPTION( target,            1,  0,  2,0,0,1, "target phases (1=stable only)") \
 OPTION( terminateint,     10,  0,1e4,0,0,1, "termination check interval") \
 OPTION( ternary,           1,  0,  1,0,1,1, "hyper ternary resolution") \
@@ -172,6 +204,8 @@ OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,2e9,1,0,1, "minimum efficiency") \
 OPTION( transredreleff,  1e2,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( unhide,            1,  0,  1,0,1,1, "unhiding by stamping BIG") \
+OPTION( unhiderounds,      1,  1, 16,1,0,1, "unhiding rounds") \
 QUTOPT( verbose,           0,  0,  3,0,0,0, "more verbose messages") \
 OPTION( vivify,            1,  0,  1,0,1,1, "vivification") \
 OPTION( vivifymaxeff,    2e7,  0,2e9,1,0,1, "maximum efficiency") \
@@ -0,0 +1,38 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+Pool::Pool () : top (0), end (0), live (0), large (0) {
+  for (unsigned c = 0; c <= max_class; c++)
+    free_lists[c] = 0;
+}
+
+Pool::~Pool () {
+  assert (!live);
+  for (const auto & slab : slabs)
+    delete [] slab;
+}
+
+// The remaining space of the last slab is wasted, but since all blocks are
+// at most 1/32 of the slab size this is negligible.
+
+void * Pool::allocate_from_new_slab (size_t bytes) {
+  assert (bytes <= slab_bytes);
+  char * slab = new char [slab_bytes];
+  slabs.push_back (slab);
+  top = slab + bytes;
+  end = slab + slab_bytes;
+  return slab;
+}
+
+void Pool::release () {
+  if (live) return;
+  for (const auto & slab : slabs)
+    delete [] slab;
+  erase_vector (slabs);
+  for (unsigned c = 0; c <= max_class; c++)
+    free_lists[c] = 0;
+  top = end = 0;
+}
+
+}
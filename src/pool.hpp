@@ -0,0 +1,135 @@
+#ifndef _pool_hpp_INCLUDED
+#define _pool_hpp_INCLUDED
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// The occurrence lists 'otab' and the binary implication graph 'big' have
+// one small vector for each literal and are allocated and released as a
+// whole (in 'init_occs' and 'reset_occs' respectively 'init_bins' and
+// 'reset_bins') several times during preprocessing and inprocessing.
+// Instead of calling the general purpose allocator for each of these many
+// small blocks, their memory is taken from a pool of large slabs.  Freed
+// blocks are kept on free lists for power-of-two size classes, which
+// matches the capacity doubling of growing vectors.  Blocks larger than
+// the largest size class are allocated directly.  As soon all blocks have
+// been returned to the pool, 'release' deallocates all slabs at once.
+
+class Pool {
+
+  static const unsigned min_class = 4;  // 16 bytes
+  static const unsigned max_class = 15; // 32 kilobytes
+  static const size_t slab_bytes = (size_t) 1 << 20;
+
+  struct Block { Block * next; };
+
+  Block * free_lists[max_class + 1];
+  vector<char *> slabs;         // allocated slabs
+  char * top, * end;            // remaining space in last slab
+  size_t live;                  // number of allocated blocks
+  size_t large;                 // bytes of directly allocated blocks
+
+  static unsigned size_class (size_t bytes) {
+    unsigned res = min_class;
+    while (((size_t) 1 << res) < bytes) res++;
+    return res;
+  }
+
+  void * allocate_from_new_slab (size_t bytes);
+
+public:
+
+  Pool ();
+  ~Pool ();
+
+  void * allocate (size_t bytes) {
+    if (bytes > ((size_t) 1 << max_class)) {
+      large += bytes;
+      return ::operator new (bytes);
+    }
+    const unsigned c = size_class (bytes);
+    live++;
+    Block * b = free_lists[c];
+    if (b) { free_lists[c] = b->next; return b; }
+    bytes = (size_t) 1 << c;
+    if ((size_t) (end - top) < bytes) return allocate_from_new_slab (bytes);
+    void * res = top;
+    top += bytes;
+    return res;
+  }
+
+  void deallocate (void * p, size_t bytes) {
+    if (bytes > ((size_t) 1 << max_class)) {
+      large -= bytes;
+      ::operator delete (p);
+      return;
+    }
+    const unsigned c = size_class (bytes);
+    Block * b = (Block *) p;
+    b->next = free_lists[c];
+    free_lists[c] = b;
+    live--;
+  }
+
+  void release ();              // release all slabs if no block is live
+
+  // All slabs (including free and wasted space) and large blocks.
+  //
+  size_t bytes () const {
+    return slabs.size () * slab_bytes + slabs.capacity () * sizeof (char *) +
+           large;
+  }
+};
+
+// Standard allocator interface for vectors allocated from a pool.  Default
+// constructed allocators (without pool) use the standard allocator, which
+// keeps for instance local copies of occurrence lists working.  Since the
+// allocator is propagated on assignment and swapping, memory is always
+// returned to where it came from.
+
+template<class T> struct PoolAllocator {
+
+  typedef T value_type;
+
+  typedef true_type propagate_on_container_copy_assignment;
+  typedef true_type propagate_on_container_move_assignment;
+  typedef true_type propagate_on_container_swap;
+
+  Pool * pool;
+
+  PoolAllocator () : pool (0) { }
+  PoolAllocator (Pool * p) : pool (p) { }
+  template<class U>
+  PoolAllocator (const PoolAllocator<U> & other) : pool (other.pool) { }
+
+  T * allocate (size_t n) {
+    const size_t bytes = n * sizeof (T);
+    if (pool) return (T *) pool->allocate (bytes);
+    return (T *) ::operator new (bytes);
+  }
+
+  void deallocate (T * p, size_t n) {
+    if (pool) pool->deallocate (p, n * sizeof (T));
+    else ::operator delete (p);
+  }
+};
+
+template<class T, class U>
+bool operator == (const PoolAllocator<T> & a, const PoolAllocator<U> & b) {
+  return a.pool == b.pool;
+}
+
+template<class T, class U>
+bool operator != (const PoolAllocator<T> & a, const PoolAllocator<U> & b) {
+  return a.pool != b.pool;
+}
+
+}
+
+#endif
@@ -9,7 +9,9 @@ namespace CaDiCaL {
 // resolvents but only probes on roots of the binary implication graph.  The
 // search for failed literals is limited, but untried roots are kept until
 // the next time 'probe' is called.  Left over probes from the last attempt
-// and new probes are tried until the limit is hit or all are tried.
+// and new probes are tried until the limit is hit or all are tried.  By
+// default probes are organized in trees to share propagations (see
+// 'probe_tree' below).
 
 /*------------------------------------------------------------------------*/
 
@@ -543,6 +545,113 @@ int Internal::next_probe () {
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+// Tree based probing following our CPAIOR'13 paper on tree-based look
+// ahead.  Instead of propagating each probe from scratch we walk a
+// spanning forest of the binary implication graph, where the root of each
+// tree is a literal implied by all literals in the tree.  Starting at the
+// root, the literals implying the current literal (its children in the
+// tree) are assigned on top of its already propagated trail, which is then
+// extended by propagating the child.  After all the children of a child
+// have been visited we backtrack to the trail of the parent only.  Thus
+// the propagation of the common implied literals of all probes in a tree
+// is shared and the root probes of the binary implication graph end up as
+// leaves of the trees.
+//
+// All literals are assigned on decision level one, and the last assigned
+// child becomes the root of the implication tree used for hyper binary
+// resolution and failed literal analysis ('probe_dominator').  Since the
+// dominator computation requires parents to precede their children on the
+// trail, the trail position of a child is overwritten by a position
+// smaller than those of all other literals on decision level one.
+
+// Insert a chain of implied literals starting at 'probe' into the forest,
+// preferring edges joining the forest, until the forest or a literal
+// without edges to unassigned literals (a new root) is reached.
+
+void Internal::probe_forest_insert (ProbeForest & forest, int probe) {
+  assert (!val (probe));
+  vector<int> & tree = forest.tree;
+  vector<char> & chain = forest.chain;
+  vector<int> lits;
+  int lit = probe;
+  while (!tree[vlit (lit)]) {
+    const unsigned u = vlit (lit);
+    lits.push_back (lit);
+    chain[u] = 1;
+    int next = 0;
+    const size_t end = forest.graph.end (u);
+    for (size_t k = forest.graph.begin (u); k != end; k++) {
+      const int other = forest.graph.targets[k];
+      if (val (other)) continue;
+      if (chain[vlit (other)]) continue;
+      next = other;
+      if (tree[vlit (other)]) break;
+    }
+    if (!next) { tree[u] = lit; break; }
+    tree[u] = next;
+    lit = next;
+  }
+  for (const auto & other : lits)
+    chain[vlit (other)] = 0;
+}
+
+// Probe all literals in the tree of 'probe' with shared propagation.  If a
+// literal fails we stop, since after learning the units we are back on
+// the root level, and leave the rest of the tree to later probes.
+
+void Internal::probe_tree (ProbeForest & forest, int probe, int64_t limit) {
+
+  int root = probe;
+  for (;;) {
+    const int parent = forest.tree[vlit (root)];
+    assert (parent);
+    if (parent == root || val (parent)) break;
+    root = parent;
+  }
+
+  stats.probetrees++;
+  stats.probed++;
+  LOG ("tree probing %d with root %d", probe, root);
+  probe_assign_decision (root);
+  if (!probe_propagate ()) { failed_literal (root); return; }
+
+  int key = var (root).trail;
+  vector<ProbeFrame> stack;
+  stack.push_back (
+    ProbeFrame (root, forest.graph.begin (vlit (-root)), trail.size ()));
+
+  while (!stack.empty () &&
+         stats.propagations.probe < limit &&
+         !terminated_asynchronously ()) {
+    ProbeFrame & frame = stack.back ();
+    if (frame.pos == forest.graph.end (vlit (-frame.lit))) {
+      stack.pop_back ();
+      if (stack.empty ()) break;
+      const ProbeFrame & parent = stack.back ();
+      probe_backtrack (parent.trail);
+      set_parent_reason_literal (parent.lit, 0);
+      continue;
+    }
+    const int child = -forest.graph.targets[frame.pos++];
+    if (forest.tree[vlit (child)] != frame.lit) continue;
+    if (val (child)) continue;
+    stats.probed++;
+    LOG ("tree probing %d implying %d", child, frame.lit);
+    probe_assign (child, 0);
+    var (child).trail = --key;
+    set_parent_reason_literal (frame.lit, child);
+    if (!probe_propagate ()) { failed_literal (child); return; }
+    stack.push_back (
+      ProbeFrame (child, forest.graph.begin (vlit (-child)), trail.size ()));
+  }
+
+  backtrack ();
+}
+
+/*------------------------------------------------------------------------*/
+
 bool Internal::probe_round () {
 
   if (unsat) return false;
@@ -586,11 +695,42 @@ bool Internal::probe_round () {
   assert (unsat || propagated == trail.size ());
   propagated = propagated2 = trail.size ();
 
+  ProbeForest forest;
+  if (opts.probetree) {
+    init_bin_graph (forest.graph, true);
+    forest.tree.resize (2*vsize, 0);
+    forest.chain.resize (2*vsize, 0);
+  }
+
   int probe;
   while (!unsat &&
          !terminated_asynchronously () &&
          stats.propagations.probe < limit &&
          (probe = next_probe ())) {
+
+    if (opts.probetree) {
+
+      // Insert all scheduled probes in priority order, once for every
+      // generated schedule, before probing the first tree.
+      //
+      if (!forest.tree[vlit (probe)]) {
+        probe_forest_insert (forest, probe);
+        for (auto i = probes.rbegin (); i != probes.rend (); i++)
+          if (active (*i) && !forest.tree[vlit (*i)])
+            probe_forest_insert (forest, *i);
+      }
+
+      probe_tree (forest, probe, limit);
+
+      // Probe it on its own if it was skipped in its tree or the tree was
+      // left early due to a failed literal.
+      //
+      if (unsat) break;
+      if (val (probe)) continue;
+      if (propfixed (probe) >= stats.all.fixed) continue;
+      if (stats.propagations.probe >= limit) break;
+    }
+
     stats.probed++;
     LOG ("probing %d", probe);
     probe_assign_decision (probe);
@@ -598,6 +738,8 @@ bool Internal::probe_round () {
     else failed_literal (probe);
   }
 
+  erase_bin_graph (forest.graph);
+
   if (unsat) LOG ("probing derived empty clause");
   else if (propagated < trail.size ()) {
     LOG ("probing produced %zd units", (size_t)(trail.size () - propagated));
@@ -655,6 +797,8 @@ void CaDiCaL::Internal::probe (bool update_limits) {
     if (!probe_round ())
       break;
 
+  sweep ();             // Equivalences are substituted by ...
+
   decompose ();         // ... and (ELS) afterwards.
 
   last.probe.propagations = stats.propagations.search;
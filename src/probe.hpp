@@ -0,0 +1,30 @@
+#ifndef _probe_hpp_INCLUDED
+#define _probe_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Spanning forest of the binary implication graph used for tree based
+// probing in 'probe.cpp'.  Each literal in the forest points to one literal
+// it implies ('tree'), or to itself if it is the root of a tree.  Thus the
+// tree children of a literal are the literals implying it, which are found
+// in the snapshot 'graph' as negations of the literals implied by its
+// negation.  All literal tables are indexed by 'vlit'.
+
+struct ProbeForest {
+  BinGraph graph;               // binary implication graph snapshot
+  vector<int> tree;             // implied tree parent or root itself
+  vector<char> chain;           // literal on chain currently inserted
+};
+
+// Depth first search stack entry of tree based probing.
+
+struct ProbeFrame {
+  int lit;                      // assigned tree literal
+  size_t pos;                   // next edge of '-lit' to traverse
+  size_t trail;                 // trail size after propagating 'lit'
+  ProbeFrame (int l, size_t p, size_t t) : lit (l), pos (p), trail (t) { }
+};
+
+}
+
+#endif
@@ -42,11 +42,14 @@ PROFILE(analyze,3) \
 PROFILE(backward,3) \
 PROFILE(block,2) \
 PROFILE(bump,4) \
+PROFILE(bva,2) \
+PROFILE(card,2) \
 PROFILE(checking,2) \
 PROFILE(cdcl,1) \
 PROFILE(collect,3) \
 PROFILE(compact,3) \
 PROFILE(condition,2) \
+PROFILE(coremin,2) \
 PROFILE(connect,3) \
 PROFILE(copy,4) \
 PROFILE(cover,2) \
@@ -54,6 +57,7 @@ PROFILE(decide,3) \
 PROFILE(decompose,3) \
 PROFILE(elim,2) \
 PROFILE(extend,3) \
+PROFILE(gauss,2) \
 PROFILE(instantiate,2) \
 PROFILE(lucky,2) \
 PROFILE(lookahead,2) \
@@ -72,8 +76,10 @@ PROFILE(stable,2) \
 PROFILE(preprocess,2) \
 PROFILE(simplify,1) \
 PROFILE(subsume,2) \
+PROFILE(sweep,2) \
 PROFILE(ternary,2) \
 PROFILE(transred,3) \
+PROFILE(unhide,3) \
 PROFILE(unstable,2) \
 PROFILE(vivify,2) \
 PROFILE(walk,2) \
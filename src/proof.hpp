@@ -57,6 +57,8 @@ public:
   void strengthen_clause (Clause *, int); // remove second argument
 
   void flush ();
+
+  size_t bytes () const;        // allocated memory in bytes
 };
 
 }
@@ -0,0 +1,359 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// External propagators allow to lazily add theory reasoning to the CDCL
+// search loop.  Assignments of observed variables are notified in trail
+// order (together with new decision levels) before the propagator is asked
+// for implied literals and new clauses.  Implied literals have to be
+// justified by a reason clause, which we request eagerly as soon the
+// literal is propagated.  The reason clause is then added as redundant
+// clause and used as ordinary reason by 'search_assign_driving'.  Thus
+// conflict analysis does not need to know about external propagation at
+// all and 'reduce' collects reason clauses which are not needed anymore.
+// Other external clauses are added as irredundant clauses (they might
+// not be implied by the formula).  Finally a complete assignment is only
+// returned as model if the propagator accepts it.
+//
+// In order to not lose theory lemmas all observed variables are frozen.
+// This keeps variable elimination, blocked clause elimination and
+// equivalent literal substitution from removing them.  We also do not use
+// lucky phases nor local search to find models with a connected propagator.
+
+/*------------------------------------------------------------------------*/
+
+void External::connect_propagator (ExternalPropagator * p) {
+  assert (p);
+  if (propagator) disconnect_propagator ();
+  reset_extended ();
+  internal->backtrack ();
+  propagator = p;
+  internal->notified = internal->trail.size ();
+  internal->notified_level = 0;
+  LOG ("connected external propagator");
+}
+
+void External::disconnect_propagator () {
+  assert (propagator);
+  for (size_t eidx = 1; eidx < observedtab.size (); eidx++)
+    if (observedtab[eidx]) melt ((int) eidx);
+  erase_vector (observedtab);
+  propagator = 0;
+  LOG ("disconnected external propagator");
+}
+
+// An observed variable might have been eliminated before.  Internalizing
+// both of its literals restores the clauses on the extension stack which
+// have it as witness.  Root-level assignments of the variable which were
+// already on the trail before it became observed are notified directly.
+
+void External::add_observed_var (int elit) {
+  assert (propagator);
+  const int eidx = abs (elit);
+  if (observed (eidx)) return;
+  internal->backtrack ();
+  freeze (eidx);
+  internalize (-eidx);
+  internal->notify_assignments ();
+  if ((size_t) eidx >= observedtab.size ())
+    observedtab.resize (eidx + 1, false);
+  observedtab[eidx] = true;
+  LOG ("observing external variable %d", eidx);
+  const int ilit = e2i[eidx];
+  const int tmp = internal->fixed (ilit);
+  if (tmp) propagator->notify_assignment (tmp < 0 ? -eidx : eidx, true);
+}
+
+void External::remove_observed_var (int elit) {
+  const int eidx = abs (elit);
+  if (!observed (eidx)) return;
+  observedtab[eidx] = false;
+  melt (eidx);
+  LOG ("stopped observing external variable %d", eidx);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Notify all not yet notified assignments of observed variables on the
+// trail and the decision levels started in between.  After backtracking
+// 'notified' is reset to the start of the trail of the backtrack level,
+// which means that out-of-order assigned literals kept on the trail by
+// chronological backtracking are notified again.
+
+void Internal::notify_assignments () {
+  ExternalPropagator * propagator = external->propagator;
+  if (!propagator) return;
+  const size_t end = trail.size ();
+  while (notified < end) {
+    while (notified_level < level &&
+           (size_t) control[notified_level + 1].trail <= notified) {
+      notified_level++;
+      propagator->notify_new_decision_level ();
+    }
+    const int ilit = trail[notified++];
+    const int elit = externalize (ilit);
+    if (!external->observed (elit)) continue;
+    const bool is_fixed = !var (ilit).level;
+    LOG ("notifying assignment %d as external %d", ilit, elit);
+    propagator->notify_assignment (elit, is_fixed);
+    stats.extprop.notified++;
+  }
+  while (notified_level < level) {
+    notified_level++;
+    propagator->notify_new_decision_level ();
+  }
+}
+
+int Internal::internalize_observed (int elit) {
+  if (!elit || elit == INT_MIN || !external->observed (elit))
+    FATAL ("external propagator uses invalid or unobserved literal %d",
+      elit);
+  return external->internalize (elit);
+}
+
+/*------------------------------------------------------------------------*/
+
+// The literals of a lazily added clause are watched in this order:
+// unassigned literals, then satisfied literals with lower assignment level
+// first and finally falsified literals with higher assignment level first.
+
+static int64_t
+lazy_watch_rank (Internal * internal, int lit) {
+  const signed char tmp = internal->val (lit);
+  const int64_t lit_level = internal->var (lit).level;
+  if (!tmp) return 2 * (int64_t) INT_MAX + 2;
+  if (tmp > 0) return 2 * (int64_t) INT_MAX + 1 - lit_level;
+  return lit_level;
+}
+
+// Add the external clause in 'original' (of internal literals) during
+// search.  Duplicated and root-level falsified literals are removed, and
+// tautological and root-level satisfied clauses skipped.
+
+void Internal::add_external_clause (bool redundant) {
+
+  assert (!conflict);
+  assert (clause.empty ());
+  LOG (original, "external %s clause",
+    redundant ? "redundant" : "irredundant");
+
+  if (opts.check && (opts.checkwitness || opts.checkfailed)) {
+    for (const auto & lit : original)
+      external->original.push_back (externalize (lit));
+    external->original.push_back (0);
+  }
+
+  bool skip = false;
+  if (unsat) {
+    LOG ("skipping clause since formula already inconsistent");
+    skip = true;
+  } else {
+    for (const auto & lit : original) {
+      int tmp = marked (lit);
+      if (tmp > 0) {
+        LOG ("removing duplicated literal %d", lit);
+      } else if (tmp < 0) {
+        LOG ("tautological since both %d and %d occur", -lit, lit);
+        skip = true;
+      } else {
+        mark (lit);
+        tmp = fixed (lit);
+        if (tmp < 0) {
+          LOG ("removing root-level falsified literal %d", lit);
+        } else if (tmp > 0) {
+          LOG ("satisfied since literal %d root-level true", lit);
+          skip = true;
+        } else clause.push_back (lit);
+      }
+    }
+    for (const auto & lit : original)
+      unmark (lit);
+  }
+
+  if (skip) {
+    clause.clear ();
+    original.clear ();
+    return;
+  }
+
+  if (proof) {
+    proof->add_original_clause (original);
+    if (clause.size () < original.size ()) {
+      proof->add_derived_clause (clause);
+      proof->delete_clause (original);
+    }
+  }
+  original.clear ();
+
+  add_lazy_clause (redundant);
+}
+
+// Add the clause in 'clause' derived lazily during search.  It should not
+// contain duplicated nor root-level assigned literals.  The clause is
+// watched and, if it is falsified or forces a literal under the current
+// assignment, we backtrack to the right level and either assign the forced
+// literal or set 'conflict' for 'analyze'.  This is shared by external
+// propagation and Gaussian elimination ('gauss.cpp').
+
+void Internal::add_lazy_clause (bool redundant) {
+
+  assert (!conflict);
+  assert (!unsat);
+
+  const size_t size = clause.size ();
+
+  if (!size) {
+    VERBOSE (1, "found falsified lazily added clause");
+    unsat = true;
+  } else if (size == 1) {
+    const int unit = clause[0];
+    backtrack ();
+    assign_original_unit (unit);
+    if (unsat) conflict = 0;
+  } else {
+
+    // Move the two watched literals to the front.
+    //
+    for (size_t i = 0; i < 2; i++) {
+      size_t best_position = i;
+      int64_t best_rank = lazy_watch_rank (this, clause[i]);
+      for (size_t j = i + 1; j < size; j++) {
+        const int64_t rank = lazy_watch_rank (this, clause[j]);
+        if (rank <= best_rank) continue;
+        best_position = j;
+        best_rank = rank;
+      }
+      swap (clause[i], clause[best_position]);
+    }
+
+    Clause * c = new_clause (redundant, (int) size);
+    watch_clause (c);
+
+    const int lit0 = c->literals[0], lit1 = c->literals[1];
+    const signed char tmp0 = val (lit0), tmp1 = val (lit1);
+
+    if (tmp1 >= 0) {
+      LOG (c, "two non-falsified watches in");
+    } else {
+      const int level0 = var (lit0).level, level1 = var (lit1).level;
+      assert (level1 > 0);
+      if (tmp0 > 0 && level0 <= level1) {
+        LOG (c, "satisfied at assignment level %d", level0);
+      } else if (tmp0 < 0 && level0 == level1) {
+        LOG (c, "falsified on decision level %d", level0);
+        backtrack (level0);
+        conflict = c;
+      } else {
+        LOG (c, "forcing %d at assignment level %d", lit0, level1);
+        if (tmp0) backtrack (level1);
+        assert (!val (lit0));
+        search_assign_driving (lit0, c);
+      }
+    }
+  }
+  clause.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Notifies the propagator, adds its clauses and asks it for propagations
+// until it neither adds clauses nor propagates anymore and all resulting
+// assignments have been propagated.  Returns 'false' on a conflict (which
+// then is in 'conflict') or if the formula became inconsistent.
+
+bool Internal::external_propagate () {
+
+  ExternalPropagator * propagator = external->propagator;
+  if (!propagator) return true;
+
+  assert (!conflict);
+  assert (!unsat);
+  assert (propagated == trail.size ());
+
+  for (;;) {
+
+    notify_assignments ();
+
+    while (!conflict && !unsat && propagator->cb_has_external_clause ()) {
+      int elit;
+      while ((elit = propagator->cb_add_external_clause_lit ()))
+        original.push_back (internalize_observed (elit));
+      stats.extprop.clauses++;
+      add_external_clause (false);
+    }
+
+    while (!conflict && !unsat && propagated == trail.size ()) {
+      notify_assignments ();            // units might have been added
+      const int elit = propagator->cb_propagate ();
+      if (!elit) break;
+      const int ilit = internalize_observed (elit);
+      if (val (ilit) > 0) continue;
+      LOG ("external propagation of %d as %d", elit, ilit);
+      stats.extprop.propagated++;
+      int other;
+      while ((other = propagator->cb_add_reason_clause_lit (elit)))
+        original.push_back (internalize_observed (other));
+      add_external_clause (true);
+      if (!conflict && !unsat && val (ilit) <= 0)
+        FATAL ("reason clause does not propagate literal %d", elit);
+    }
+
+    if (conflict || unsat) return false;
+    if (propagated == trail.size ()) return true;
+    if (!propagate ()) return false;
+  }
+}
+
+// Called with a complete assignment, which is returned as model (result
+// '10') only if the propagator accepts it.  Otherwise the propagator has
+// to add at least one clause falsified by the assignment and we return
+// zero to continue search.
+
+int Internal::external_check_model () {
+
+  ExternalPropagator * propagator = external->propagator;
+  if (!propagator) return 10;
+
+  notify_assignments ();
+
+  vector<int> model;
+  for (size_t eidx = 1; eidx < external->observedtab.size (); eidx++) {
+    if (!external->observedtab[eidx]) continue;
+    const int ilit = external->e2i[eidx];
+    assert (ilit);
+    const signed char tmp = val (ilit);
+    assert (tmp);
+    model.push_back (tmp < 0 ? -(int) eidx : (int) eidx);
+  }
+
+  stats.extprop.checks++;
+  if (propagator->cb_check_found_model (model)) {
+    LOG ("external propagator accepted model");
+    return 10;
+  }
+  LOG ("external propagator rejected model");
+  stats.extprop.rejected++;
+
+  // Since the assignment is complete, a falsified clause either results
+  // in a conflict or we have to backtrack (or the formula is inconsistent).
+
+  const int before = level;
+  bool added = false;
+  while (!conflict && !unsat && propagator->cb_has_external_clause ()) {
+    int elit;
+    while ((elit = propagator->cb_add_external_clause_lit ()))
+      original.push_back (internalize_observed (elit));
+    stats.extprop.clauses++;
+    add_external_clause (false);
+    added = true;
+  }
+
+  if (!added)
+    FATAL ("external propagator rejected model without adding a clause");
+  if (!conflict && !unsat && level == before)
+    FATAL ("external clauses do not falsify rejected model");
+
+  return 0;
+}
+
+}
@@ -22,6 +22,7 @@ bool Internal::reducing () {
 // Even less regularly we are flushing all redundant clauses.
 
 bool Internal::flushing () {
+  if (lim.memflush) return true;        // forced by memory limit
   if (!opts.flush) return false;
   return stats.conflicts >= lim.flush;
 }
@@ -53,17 +54,11 @@ void Internal::mark_clauses_to_be_flushed () {
 //
 // In earlier versions we pre-computed a 64-bit sort key per clause and
 // wrapped a pointer to the clause and the 64-bit sort key into a separate
-// data structure for sorting.  This was probably faster but awkward and
-// so we moved back to a simpler scheme which also uses 'stable_sort'
-// instead of 'rsort' below.  Sorting here is not a hot-spot anyhow.
-
-struct reduce_less_useful {
-  bool operator () (const Clause * c, const Clause * d) const {
-    if (c->glue > d->glue) return true;
-    if (c->glue < d->glue) return false;
-    return c->size > d->size;
-  }
-};
+// data structure for sorting.  Later we used 'stable_sort' on candidates
+// with glue and size as keys.  With millions of learned clauses even
+// sorting showed up in profiles though.  Now we select the least useful
+// clauses with histograms on glue and size in linear time instead, which
+// gives exactly the same result as stable sorting (see below).
 
 // This function implements the important reduction policy. It determines
 // which redundant clauses are considered not useful and thus will be
@@ -71,11 +66,12 @@ struct reduce_less_useful {
 
 void Internal::mark_useless_redundant_clauses_as_garbage () {
 
-  // We use a separate stack for sorting candidates for removal.  This uses
-  // (slightly) more memory but has the advantage to keep the relative order
-  // in 'clauses' intact, which actually due to using stable sorting goes
-  // into the candidate selection (more recently learned clauses are kept if
-  // they otherwise have the same glue and size).
+  // We use a separate stack for selecting candidates for removal.  This
+  // uses (slightly) more memory but has the advantage to keep the relative
+  // order in 'clauses' intact, which actually goes into the candidate
+  // selection (more recently learned clauses are kept if they otherwise
+  // have the same glue and size).  It also saves the 'used' flags before
+  // they are decremented below.
 
   vector<Clause *> stack;
 
@@ -98,8 +94,6 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
     stack.push_back (c);
   }
 
-  stable_sort (stack.begin (), stack.end (), reduce_less_useful ());
-
   size_t target = 1e-2 * opts.reducetarget * stack.size ();
 
   // This is defensive code, which I usually consider a bug, but here I am
@@ -111,24 +105,59 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
   PHASE ("reduce", stats.reductions, "reducing %zd clauses %.0f%%",
     target, percent (target, stats.current.redundant));
 
-  auto i = stack.begin ();
-  const auto t = i + target;
-  while (i != t) {
-    Clause * c = *i++;
-    LOG (c, "marking useless to be collected");
-    mark_garbage (c);
-    stats.reduced++;
+  // The 'target' least useful candidates are those with largest glue, then
+  // largest size and for the same glue and size those learned first.  We
+  // first determine with a histogram over glues the cut-off glue, such that
+  // all candidates with larger glue are removed but only some with the
+  // cut-off glue.  Among the latter a second histogram over sizes gives the
+  // cut-off size.  Finally the first 'remain' candidates with both cut-off
+  // glue and size (in the order of 'clauses') are removed too.
+
+  int max_glue = 0, max_size = 0;
+  for (const auto & c : stack) {
+    if (c->glue > max_glue) max_glue = c->glue;
+    if (c->size > max_size) max_size = c->size;
   }
 
+  vector<size_t> count (max_glue + 1, 0);
+  for (const auto & c : stack)
+    count[c->glue]++;
+
+  size_t remain = target;
+  int cut_glue = max_glue;
+  while (cut_glue > 0 && count[cut_glue] < remain)
+    remain -= count[cut_glue--];
+
+  count.assign (max_size + 1, 0);
+  for (const auto & c : stack)
+    if (c->glue == cut_glue)
+      count[c->size]++;
+
+  int cut_size = max_size;
+  while (cut_size > 0 && count[cut_size] < remain)
+    remain -= count[cut_size--];
+
+  erase_vector (count);
+
   lim.keptsize = lim.keptglue = 0;
 
-  const auto end = stack.end ();
-  for (i = t; i != end; i++) {
-    Clause * c = *i;
-    LOG (c, "keeping");
-    if (c->size > lim.keptsize) lim.keptsize = c->size;
-    if (c->glue > lim.keptglue) lim.keptglue = c->glue;
+  for (const auto & c : stack) {
+    bool useless;
+    if (c->glue != cut_glue) useless = (c->glue > cut_glue);
+    else if (c->size != cut_size) useless = (c->size > cut_size);
+    else if (remain) remain--, useless = true;
+    else useless = false;
+    if (useless) {
+      LOG (c, "marking useless to be collected");
+      mark_garbage (c);
+      stats.reduced++;
+    } else {
+      LOG (c, "keeping");
+      if (c->size > lim.keptsize) lim.keptsize = c->size;
+      if (c->glue > lim.keptglue) lim.keptglue = c->glue;
+    }
   }
+  assert (!remain);
 
   erase_vector (stack);
 
@@ -171,6 +200,7 @@ void Internal::reduce () {
 
   bool flush = flushing ();
   if (flush) stats.flush.count++;
+  lim.memflush = false;
 
   if (!propagate_out_of_order_units ()) goto DONE;
 
@@ -191,6 +191,14 @@ log_api_call_returns (Internal * internal,
   log_api_call (internal, name, lit, fmt);
 }
 
+static void
+log_api_call_returns (Internal * internal,
+                      const char * name, const char * arg, int64_t res) {
+  char fmt[32];
+  sprintf (fmt, "returns '%" PRId64 "'", res);
+  log_api_call (internal, name, arg, fmt);
+}
+
 static void
 log_api_call_returns (Internal * internal,
                       const char * name, const char * arg, bool res) {
@@ -287,6 +295,32 @@ Solver::trace_api_call (const char * s0, const char * s1, int i2) const {
   fflush (trace_api_file);
 }
 
+// The bulk API calls are traced as sequence of individual calls, such
+// that 'mobical' can replay them without knowing about bulk calls.
+
+void Solver::trace_api_calls (const char * s0, const int * lits,
+                              size_t size, bool zero) const {
+  assert (trace_api_file);
+  for (const int * p = lits; p != lits + size; p++) {
+    LOG ("TRACE %s %d", s0, *p);
+    fprintf (trace_api_file, "%s %d\n", s0, *p);
+  }
+  if (zero) {
+    LOG ("TRACE %s 0", s0);
+    fprintf (trace_api_file, "%s 0\n", s0);
+  }
+  fflush (trace_api_file);
+}
+
+#define TRACE_ALL(NAME,CALL,LITS,SIZE,ZERO) \
+do { \
+  if ((this == 0)) break; \
+  if ((internal == 0)) break; \
+  LOG_API_CALL_BEGIN (NAME, (int) (SIZE)); \
+  if (!trace_api_file) break; \
+  trace_api_calls (CALL, LITS, SIZE, ZERO); \
+} while (0)
+
 /*------------------------------------------------------------------------*/
 
 // The global 'tracing_api_calls_through_environment_variable_method' flag
@@ -306,6 +340,7 @@ static bool tracing_api_calls_through_environment_variable_method;
 /*------------------------------------------------------------------------*/
 
 #define TRACE(...) do { } while (0)
+#define TRACE_ALL(...) do { } while (0)
 
 /*------------------------------------------------------------------------*/
 #endif
@@ -397,7 +432,7 @@ Solver::~Solver () {
 int Solver::vars () {
   TRACE ("vars");
   REQUIRE_VALID_OR_SOLVING_STATE ();
-  int res = external->max_var;
+  int res = external->user_max_var ();
   LOG_API_CALL_RETURNS ("vars", res);
   return res;
 }
@@ -528,6 +563,7 @@ void Solver::add (int lit) {
   TRACE ("add", lit);
   REQUIRE_VALID_STATE ();
   if (lit) REQUIRE_VALID_LIT (lit);
+  if (lit) REQUIRE_NON_GROUP_LIT (lit);
   transition_to_unknown_state ();
   external->add (lit);
   adding_clause = lit;
@@ -540,6 +576,7 @@ void Solver::constrain (int lit) {
   TRACE ("constrain", lit);
   REQUIRE_VALID_STATE ();
   if (lit) REQUIRE_VALID_LIT (lit);
+  if (lit) REQUIRE_NON_GROUP_LIT (lit);
   transition_to_unknown_state ();
   external->constrain (lit);
   adding_constraint = lit;
@@ -552,6 +589,7 @@ void Solver::assume (int lit) {
   TRACE ("assume", lit);
   REQUIRE_VALID_STATE ();
   REQUIRE_VALID_LIT (lit);
+  REQUIRE_NON_GROUP_LIT (lit);
   transition_to_unknown_state ();
   external->assume (lit);
   LOG_API_CALL_END ("assume", lit);
@@ -595,6 +633,120 @@ void Solver::reset_constraint () {
 
 /*------------------------------------------------------------------------*/
 
+// Bulk versions of 'add', 'assume' and 'val'.  The API contract is checked
+// once per call and literals are checked in a tight loop, which also
+// determines the maximum variable index, such that the external and
+// internal tables are only enlarged once.
+
+void Solver::add_clause (const int * lits, size_t size) {
+  TRACE_ALL ("add_clause", "add", lits, size, true);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (!adding_clause,
+    "previous clause incomplete (terminating zero not added)");
+  REQUIRE (lits || !size, "zero literal array");
+  int max_idx = 0;
+  for (const int * p = lits; p != lits + size; p++) {
+    const int lit = *p;
+    REQUIRE_VALID_LIT (lit);
+    REQUIRE_NON_GROUP_LIT (lit);
+    const int idx = abs (lit);
+    if (idx > max_idx) max_idx = idx;
+  }
+  transition_to_unknown_state ();
+  external->add (lits, size, max_idx);
+  external->add (0);
+  if (!adding_constraint) STATE (UNKNOWN);
+  LOG_API_CALL_END ("add_clause", (int) size);
+}
+
+void Solver::add_clauses (const int * lits, size_t size) {
+  TRACE_ALL ("add_clauses", "add", lits, size, false);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (!adding_clause,
+    "previous clause incomplete (terminating zero not added)");
+  REQUIRE (lits || !size, "zero literal array");
+  REQUIRE (!size || !lits[size-1],
+    "last clause incomplete (terminating zero missing)");
+  int max_idx = 0;
+  for (const int * p = lits; p != lits + size; p++) {
+    const int lit = *p;
+    REQUIRE (lit != INT_MIN, "invalid literal '%d'", lit);
+    if (lit) REQUIRE_NON_GROUP_LIT (lit);
+    const int idx = abs (lit);
+    if (idx > max_idx) max_idx = idx;
+  }
+  transition_to_unknown_state ();
+  external->add (lits, size, max_idx);
+  if (!adding_constraint) STATE (UNKNOWN);
+  LOG_API_CALL_END ("add_clauses", (int) size);
+}
+
+void Solver::assume_all (const int * lits, size_t size) {
+  TRACE_ALL ("assume_all", "assume", lits, size, false);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (lits || !size, "zero literal array");
+  int max_idx = 0;
+  for (const int * p = lits; p != lits + size; p++) {
+    const int lit = *p;
+    REQUIRE_VALID_LIT (lit);
+    REQUIRE_NON_GROUP_LIT (lit);
+    const int idx = abs (lit);
+    if (idx > max_idx) max_idx = idx;
+  }
+  transition_to_unknown_state ();
+  external->assume (lits, size, max_idx);
+  LOG_API_CALL_END ("assume_all", (int) size);
+}
+
+void Solver::vals (const int * lits, int * values, size_t size) {
+  TRACE_ALL ("vals", "val", lits, size, false);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () == SATISFIED,
+    "can only get value in satisfied state");
+  REQUIRE ((lits && values) || !size, "zero literal or value array");
+  if (!external->extended) external->extend ();
+  for (size_t i = 0; i < size; i++) {
+    const int lit = lits[i];
+    REQUIRE_VALID_LIT (lit);
+    values[i] = external->user_ival (lit);
+  }
+  LOG_API_CALL_END ("vals", (int) size);
+}
+
+/*------------------------------------------------------------------------*/
+
+int Solver::open_group () {
+  TRACE ("opengroup");
+  REQUIRE_READY_STATE ();
+  REQUIRE (!external->group, "group '%d' still open", external->group);
+  REQUIRE (external->max_var < INT_MAX - 1,
+    "can not allocate another group variable");
+  transition_to_unknown_state ();
+  const int res = external->open_group ();
+  LOG_API_CALL_RETURNS ("open_group", res);
+  return res;
+}
+
+void Solver::close_group () {
+  TRACE ("closegroup");
+  REQUIRE_READY_STATE ();
+  REQUIRE (external->group, "no group open");
+  external->close_group ();
+  LOG_API_CALL_END ("close_group");
+}
+
+void Solver::retract_group (int group) {
+  TRACE ("retractgroup", group);
+  REQUIRE_READY_STATE ();
+  REQUIRE (external->active_group (group),
+    "invalid group '%d' (not opened or already retracted)", group);
+  transition_to_unknown_state ();
+  external->retract_group (group);
+  LOG_API_CALL_END ("retract_group", group);
+}
+
+/*------------------------------------------------------------------------*/
+
 int Solver::call_external_solve_and_check_results (bool preprocess_only) {
   transition_to_unknown_state ();
   assert (state () & READY);
@@ -645,6 +797,23 @@ int Solver::simplify (int rounds) {
   return res;
 }
 
+int Solver::backbone (std::vector<int> & lits) {
+  TRACE ("backbone");
+  REQUIRE_READY_STATE ();
+  transition_to_unknown_state ();
+  external->reset_constraint ();
+  assert (state () & READY);
+  STATE (SOLVING);
+  const int res = external->backbone (lits);
+  if (res == 20) STATE (UNSATISFIED);
+  else {
+    STATE (UNKNOWN);
+    external->reset_assumptions ();
+  }
+  LOG_API_CALL_RETURNS ("backbone", res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 int Solver::val (int lit) {
@@ -654,7 +823,7 @@ int Solver::val (int lit) {
   REQUIRE (state () == SATISFIED,
     "can only get value in satisfied state");
   if (!external->extended) external->extend ();
-  int res = external->ival (lit);
+  int res = external->user_ival (lit);
   LOG_API_CALL_RETURNS ("val", lit, res);
   return res;
 }
@@ -693,6 +862,7 @@ void Solver::phase (int lit) {
   TRACE ("phase", lit);
   REQUIRE_VALID_STATE ();
   REQUIRE_VALID_LIT (lit);
+  REQUIRE_NON_GROUP_LIT (lit);
   external->phase (lit);
   LOG_API_CALL_END ("phase", lit);
 }
@@ -701,6 +871,7 @@ void Solver::unphase (int lit) {
   TRACE ("unphase", lit);
   REQUIRE_VALID_STATE ();
   REQUIRE_VALID_LIT (lit);
+  REQUIRE_NON_GROUP_LIT (lit);
   external->unphase (lit);
   LOG_API_CALL_END ("unphase", lit);
 }
@@ -770,6 +941,51 @@ void Solver::disconnect_learner () {
   LOG_API_CALL_END ("disconnect_learner");
 }
 
+/*------------------------------------------------------------------------*/
+
+void
+Solver::connect_external_propagator (ExternalPropagator * propagator) {
+  LOG_API_CALL_BEGIN ("connect_external_propagator");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (propagator, "can not connect zero propagator");
+#ifdef LOGGING
+  if (external->propagator)
+    LOG ("connecting new propagator (disconnecting previous one)");
+  else
+    LOG ("connecting new propagator (no previous one)");
+#endif
+  external->connect_propagator (propagator);
+  LOG_API_CALL_END ("connect_external_propagator");
+}
+
+void Solver::disconnect_external_propagator () {
+  LOG_API_CALL_BEGIN ("disconnect_external_propagator");
+  REQUIRE_VALID_STATE ();
+  if (external->propagator) external->disconnect_propagator ();
+  else LOG ("ignoring to disconnect propagator (no previous one)");
+  LOG_API_CALL_END ("disconnect_external_propagator");
+}
+
+void Solver::add_observed_var (int var) {
+  LOG_API_CALL_BEGIN ("add_observed_var", var);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (var > 0, "invalid observed variable '%d'", var);
+  REQUIRE (external->propagator,
+    "can not observe variable '%d' without connected propagator", var);
+  REQUIRE (!external->group_var (var),
+    "can not observe group variable '%d'", var);
+  external->add_observed_var (var);
+  LOG_API_CALL_END ("add_observed_var", var);
+}
+
+void Solver::remove_observed_var (int var) {
+  LOG_API_CALL_BEGIN ("remove_observed_var", var);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (var > 0, "invalid observed variable '%d'", var);
+  external->remove_observed_var (var);
+  LOG_API_CALL_END ("remove_observed_var", var);
+}
+
 /*===== IPASIR END =======================================================*/
 
 int Solver::active () const {
@@ -796,12 +1012,21 @@ int64_t Solver::irredundant () const {
   return res;
 }
 
+int64_t Solver::memory (const char * name) const {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (name, "zero name argument");
+  int64_t res = internal->memory_usage (name);
+  LOG_API_CALL_RETURNS ("memory", name, res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::freeze (int lit) {
   TRACE ("freeze", lit);
   REQUIRE_VALID_STATE ();
   REQUIRE_VALID_LIT (lit);
+  REQUIRE_NON_GROUP_LIT (lit);
   external->freeze (lit);
   LOG_API_CALL_END ("freeze", lit);
 }
@@ -810,6 +1035,7 @@ void Solver::melt (int lit) {
   TRACE ("melt", lit);
   REQUIRE_VALID_STATE ();
   REQUIRE_VALID_LIT (lit);
+  REQUIRE_NON_GROUP_LIT (lit);
   REQUIRE (external->frozen (lit),
     "can not melt completely melted literal '%d'", lit);
   external->melt (lit);
@@ -1067,6 +1293,7 @@ void Solver::dump_cnf () {
 bool Solver::traverse_clauses (ClauseIterator & it) const {
   LOG_API_CALL_BEGIN ("traverse_clauses");
   REQUIRE_VALID_STATE ();
+  external->lift_hidden_vars ();
   bool res = external->traverse_all_frozen_units_as_clauses (it) &&
              internal->traverse_clauses (it);
   LOG_API_CALL_RETURNS ("traverse_clauses", res);
@@ -1076,6 +1303,7 @@ bool Solver::traverse_clauses (ClauseIterator & it) const {
 bool Solver::traverse_witnesses_backward (WitnessIterator & it) const {
   LOG_API_CALL_BEGIN ("traverse_witnesses_backward");
   REQUIRE_VALID_STATE ();
+  external->lift_hidden_vars ();
   bool res = external->traverse_all_non_frozen_units_as_witnesses (it) &&
              external->traverse_witnesses_backward (it);
   LOG_API_CALL_RETURNS ("traverse_witnesses_backward", res);
@@ -1085,6 +1313,7 @@ bool Solver::traverse_witnesses_backward (WitnessIterator & it) const {
 bool Solver::traverse_witnesses_forward (WitnessIterator & it) const {
   LOG_API_CALL_BEGIN ("traverse_witnesses_forward");
   REQUIRE_VALID_STATE ();
+  external->lift_hidden_vars ();
   bool res = external->traverse_witnesses_forward (it) &&
              external->traverse_all_non_frozen_units_as_witnesses (it);
   LOG_API_CALL_RETURNS ("traverse_witnesses_forward", res);
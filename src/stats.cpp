@@ -55,6 +55,13 @@ void Stats::print (Internal * internal) {
 
   SECTION ("statistics");
 
+  if (all || stats.backbone.count) {
+  PRT ("backbone:        %15" PRId64 "   %10.2f    per computation", stats.backbone.checked + stats.backbone.fixed, relative (stats.backbone.checked + stats.backbone.fixed, stats.backbone.count));
+  PRT ("  backcalls:     %15" PRId64 "   %10.2f    per computation", stats.backbone.calls, relative (stats.backbone.calls, stats.backbone.count));
+  PRT ("  backchecked:   %15" PRId64 "   %10.2f    per call", stats.backbone.checked, relative (stats.backbone.checked, stats.backbone.calls));
+  PRT ("  backfixed:     %15" PRId64 "   %10.2f %%  of backbone", stats.backbone.fixed, percent (stats.backbone.fixed, stats.backbone.checked + stats.backbone.fixed));
+  PRT ("  backfiltered:  %15" PRId64 "   %10.2f    per call", stats.backbone.filtered, relative (stats.backbone.filtered, stats.backbone.calls));
+  }
   if (all || stats.blocked) {
   PRT ("blocked:         %15" PRId64 "   %10.2f %%  of irredundant clauses", stats.blocked, percent (stats.blocked, stats.added.irredundant));
   PRT ("  blockings:     %15" PRId64 "   %10.2f    internal", stats.blockings, relative (stats.conflicts, stats.blockings));
@@ -63,6 +70,23 @@ void Stats::print (Internal * internal) {
   PRT ("  pure:          %15" PRId64 "   %10.2f %%  of all variables", stats.all.pure, percent (stats.all.pure, stats.vars));
   PRT ("  pureclauses:   %15" PRId64 "   %10.2f    per pure literal", stats.blockpured, relative (stats.blockpured, stats.all.pure));
   }
+  if (all || stats.bva.vars) {
+  PRT ("bva:             %15" PRId64 "   %10.2f    per round", stats.bva.vars, relative (stats.bva.vars, stats.bva.count));
+  PRT ("  bvarounds:     %15" PRId64 "   %10.2f    internal", stats.bva.count, relative (stats.conflicts, stats.bva.count));
+  PRT ("  bvaadded:      %15" PRId64 "   %10.2f    per variable", stats.bva.added, relative (stats.bva.added, stats.bva.vars));
+  PRT ("  bvaremoved:    %15" PRId64 "   %10.2f    per variable", stats.bva.removed, relative (stats.bva.removed, stats.bva.vars));
+  PRT ("  bvaticks:      %15" PRId64 "   %10.2f    per removed", stats.bva.ticks, relative (stats.bva.ticks, stats.bva.removed));
+  }
+  if (all || stats.card.count) {
+  PRT ("cardinality:     %15" PRId64 "   %10.2f    AMOs per round", stats.card.count, relative (stats.card.amos, stats.card.count));
+  PRT ("  cardclauses:   %15" PRId64 "   %10.2f    per round", stats.card.clauses, relative (stats.card.clauses, stats.card.count));
+  PRT ("  cardresolved:  %15" PRId64 "   %10.2f    per round", stats.card.resolvents, relative (stats.card.resolvents, stats.card.count));
+  PRT ("  cardkept:      %15" PRId64 "   %10.2f %%  of resolvents", stats.card.kept, percent (stats.card.kept, stats.card.resolvents));
+  PRT ("  cardunits:     %15" PRId64 "   %10.2f    per round", stats.card.units, relative (stats.card.units, stats.card.count));
+  PRT ("  cardprops:     %15" PRId64 "   %10.2f %%  of propagations", stats.card.propagations, percent (stats.card.propagations, stats.propagations.search));
+  PRT ("  cardconfs:     %15" PRId64 "   %10.2f %%  of conflicts", stats.card.conflicts, percent (stats.card.conflicts, stats.conflicts));
+  PRT ("  cardticks:     %15" PRId64 "   %10.2f    per propagation", stats.card.ticks, relative (stats.card.ticks, stats.propagations.search));
+  }
   if (all || stats.chrono)
   PRT ("chronological:   %15" PRId64 "   %10.2f %%  of conflicts", stats.chrono, percent (stats.chrono, stats.conflicts));
   if (all)
@@ -83,6 +107,12 @@ void Stats::print (Internal * internal) {
   PRT ("  condautrem:    %19.3f  %7.2f %%  final autarky", relative (stats.condautrem, stats.conditioned), percent (stats.condautrem, stats.condassrem));
   PRT ("  condprops:     %15" PRId64 "   %10.2f    per candidate", stats.condprops, relative (stats.condprops, stats.condcands));
   }
+  if (all || stats.coremin.count) {
+  PRT ("coremin:         %15" PRId64 "   %10.2f    per minimized core", stats.coremin.original, relative (stats.coremin.original, stats.coremin.count));
+  PRT ("  propagated:    %15" PRId64 "   %10.2f %%  removed failed", stats.coremin.propagated, percent (stats.coremin.propagated, stats.coremin.original));
+  PRT ("  searched:      %15" PRId64 "   %10.2f %%  removed failed", stats.coremin.searched, percent (stats.coremin.searched, stats.coremin.original));
+  PRT ("  tests:         %15" PRId64 "   %10.2f    per minimized core", stats.coremin.tests, relative (stats.coremin.tests, stats.coremin.count));
+  }
   if (all || stats.cover.total) {
   PRT ("covered:         %15" PRId64 "   %10.2f %%  of irredundant clauses", stats.cover.total, percent (stats.cover.total, stats.added.irredundant));
   PRT ("  coverings:     %15" PRId64 "   %10.2f    interval", stats.cover.count, relative (stats.conflicts, stats.cover.count));
@@ -107,6 +137,21 @@ void Stats::print (Internal * internal) {
   PRT ("  elimres:       %15" PRId64 "   %10.2f    per eliminated", stats.elimres, relative (stats.elimres, stats.all.eliminated));
   PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution", stats.elimrestried, percent (stats.elimrestried, stats.elimres));
   }
+  if (all || stats.extprop.checks) {
+  PRT ("extprop:         %15" PRId64 "   %10.2f    per model check", stats.extprop.propagated, relative (stats.extprop.propagated, stats.extprop.checks));
+  PRT ("  notified:      %15" PRId64 "   %10.2f    per propagated", stats.extprop.notified, relative (stats.extprop.notified, stats.extprop.propagated));
+  PRT ("  clauses:       %15" PRId64 "   %10.2f    per model check", stats.extprop.clauses, relative (stats.extprop.clauses, stats.extprop.checks));
+  PRT ("  checks:        %15" PRId64 "   %10.2f    interval", stats.extprop.checks, relative (stats.conflicts, stats.extprop.checks));
+  PRT ("  rejected:      %15" PRId64 "   %10.2f %%  of model checks", stats.extprop.rejected, percent (stats.extprop.rejected, stats.extprop.checks));
+  }
+  if (all || stats.gauss.count) {
+  PRT ("gauss:           %15" PRId64 "   %10.2f    XORs per extraction", stats.gauss.count, relative (stats.gauss.xors, stats.gauss.count));
+  PRT ("  matrices:      %15" PRId64 "   %10.2f    rows per matrix", stats.gauss.matrices, relative (stats.gauss.rows, stats.gauss.matrices));
+  PRT ("  gaussunits:    %15" PRId64 "   %10.2f    per extraction", stats.gauss.units, relative (stats.gauss.units, stats.gauss.count));
+  PRT ("  gaussprops:    %15" PRId64 "   %10.2f %%  of propagations", stats.gauss.propagations, percent (stats.gauss.propagations, stats.propagations.search));
+  PRT ("  gaussconfs:    %15" PRId64 "   %10.2f %%  of conflicts", stats.gauss.conflicts, percent (stats.gauss.conflicts, stats.conflicts));
+  PRT ("  gaussticks:    %15" PRId64 "   %10.2f    per propagation", stats.gauss.ticks, relative (stats.gauss.ticks, stats.propagations.search));
+  }
   if (all || stats.all.fixed) {
   PRT ("fixed:           %15" PRId64 "   %10.2f %%  of all variables", stats.all.fixed, percent (stats.all.fixed, stats.vars));
   PRT ("  failed:        %15" PRId64 "   %10.2f %%  of all variables", stats.failed, percent (stats.failed, stats.vars));
@@ -116,6 +161,7 @@ void Stats::print (Internal * internal) {
   PRT ("  probesuccess:  %15" PRId64 "   %10.2f %%  phases", stats.probesuccess, percent (stats.probesuccess, stats.probingphases));
   PRT ("  probingrounds: %15" PRId64 "   %10.2f    per phase", stats.probingrounds, relative (stats.probingrounds, stats.probingphases));
   PRT ("  probed:        %15" PRId64 "   %10.2f    per failed", stats.probed, relative (stats.probed, stats.failed));
+  PRT ("  probetrees:    %15" PRId64 "   %10.2f    probed per tree", stats.probetrees, relative (stats.probed, stats.probetrees));
   PRT ("  hbrs:          %15" PRId64 "   %10.2f    per probed", stats.hbrs, relative (stats.hbrs, stats.probed));
   PRT ("  hbrsizes:      %15" PRId64 "   %10.2f    per hbr", stats.hbrsizes, relative (stats.hbrsizes, stats.hbrs));
   PRT ("  hbreds:        %15" PRId64 "   %10.2f %%  per hbr", stats.hbreds, percent (stats.hbreds, stats.hbrs));
@@ -165,6 +211,12 @@ void Stats::print (Internal * internal) {
   PRT ("  transredprops: %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.transred, percent (stats.propagations.transred, propagations));
   PRT ("  vivifyprops:   %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.vivify, percent (stats.propagations.vivify, propagations));
   PRT ("  walkprops:     %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.walk, percent (stats.propagations.walk, propagations));
+  if (all || stats.memlimit.checks) {
+  PRT ("memchecks:       %15" PRId64 "   %10.2f    interval", stats.memlimit.checks, relative (stats.conflicts, stats.memlimit.checks));
+  PRT ("  memreductions: %15" PRId64 "   %10.2f %%  of checks", stats.memlimit.reductions, percent (stats.memlimit.reductions, stats.memlimit.checks));
+  PRT ("  memflushes:    %15" PRId64 "   %10.2f %%  of checks", stats.memlimit.flushes, percent (stats.memlimit.flushes, stats.memlimit.checks));
+  PRT ("  memexhausted:  %15" PRId64 "   %10.2f %%  of checks", stats.memlimit.exhausted, percent (stats.memlimit.exhausted, stats.memlimit.checks));
+  }
   if (all || stats.reactivated) {
   PRT ("reactivated:     %15" PRId64 "   %10.2f %%  of all variables", stats.reactivated, percent (stats.reactivated, stats.vars));
   }
@@ -172,6 +224,8 @@ void Stats::print (Internal * internal) {
   PRT ("reduced:         %15" PRId64 "   %10.2f %%  per conflict", stats.reduced, percent (stats.reduced, stats.conflicts));
   PRT ("  reductions:    %15" PRId64 "   %10.2f    interval", stats.reductions, relative (stats.conflicts, stats.reductions));
   PRT ("  collections:   %15" PRId64 "   %10.2f    interval", stats.collections, relative (stats.conflicts, stats.collections));
+  PRT ("  arenamoving:   %15" PRId64 "   %10.2f %%  of collections", stats.arenamoving, percent (stats.arenamoving, stats.collections));
+  PRT ("  arenamoved:    %15" PRId64 "   %10.2f    bytes per moving", stats.arenamoved, relative (stats.arenamoved, stats.arenamoving));
   }
   if (all || stats.rephased.total) {
   PRT ("rephased:        %15" PRId64 "   %10.2f    interval", stats.rephased.total, relative (stats.conflicts, stats.rephased.total));
@@ -189,6 +243,9 @@ void Stats::print (Internal * internal) {
   PRT ("  reused:        %15" PRId64 "   %10.2f %%  per restart", stats.reused, percent (stats.reused, stats.restarts));
   PRT ("  reusedlevels:  %15" PRId64 "   %10.2f %%  per restart levels", stats.reusedlevels, percent (stats.reusedlevels, stats.restartlevels));
   }
+  if (all || stats.reusedassume) {
+  PRT ("reusedassume:    %15" PRId64 "   %10.2f    levels per reuse", stats.reusedassume, relative (stats.reusedalevels, stats.reusedassume));
+  }
   if (all || stats.restored) {
   PRT ("restored:        %15" PRId64 "   %10.2f %%  per weakened", stats.restored, percent (stats.restored, stats.weakened));
   PRT ("  restorations:  %15" PRId64 "   %10.2f %%  per extension", stats.restorations, percent (stats.restorations, stats.extensions));
@@ -215,6 +272,7 @@ void Stats::print (Internal * internal) {
   PRT ("  subtried:      %15" PRId64 "   %10.2f    tried per subsumed", stats.subtried, relative (stats.subtried, stats.subsumed));
   PRT ("  subchecks:     %15" PRId64 "   %10.2f    per tried", stats.subchecks, relative (stats.subchecks, stats.subtried));
   PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck", stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+  PRT ("  subfiltered:   %15" PRId64 "   %10.2f    per tried", stats.subfiltered, relative (stats.subfiltered, stats.subtried));
   PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed", stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
   PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed", stats.elimbwsub, percent (stats.elimbwsub, stats.subsumed));
   PRT ("  eagersub:      %15" PRId64 "   %10.2f %%  of subsumed", stats.eagersub, percent (stats.eagersub, stats.subsumed));
@@ -225,12 +283,29 @@ void Stats::print (Internal * internal) {
   PRT ("  elimotfstr:    %15" PRId64 "   %10.2f %%  of strengthened", stats.elimotfstr, percent (stats.elimotfstr, stats.strengthened));
   PRT ("  elimbwstr:     %15" PRId64 "   %10.2f %%  of strengthened", stats.elimbwstr, percent (stats.elimbwstr, stats.strengthened));
   }
+  if (all || stats.sweep.count) {
+  PRT ("sweeping:        %15" PRId64 "   %10.2f    interval", stats.sweep.count, relative (stats.conflicts, stats.sweep.count));
+  PRT ("  sweepgates:    %15" PRId64 "   %10.2f    per round", stats.sweep.gates, relative (stats.sweep.gates, stats.sweep.count));
+  PRT ("  sweepprobes:   %15" PRId64 "   %10.2f    per round", stats.sweep.probes, relative (stats.sweep.probes, stats.sweep.count));
+  PRT ("  sweepequivs:   %15" PRId64 "   %10.2f %%  of probes", stats.sweep.equivalences, percent (stats.sweep.equivalences, stats.sweep.probes));
+  PRT ("  sweepunits:    %15" PRId64 "   %10.2f %%  of probes", stats.sweep.units, percent (stats.sweep.units, stats.sweep.probes));
+  PRT ("  sweepticks:    %15" PRId64 "   %10.2f    per gate", stats.sweep.ticks, relative (stats.sweep.ticks, stats.sweep.gates));
+  }
   if (all || stats.htrs) {
   PRT ("ternary:         %15" PRId64 "   %10.2f %%  of resolved", stats.htrs, percent (stats.htrs, stats.ternres));
   PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.ternary, relative (stats.conflicts, stats.ternary));
   PRT ("  htr3:          %15" PRId64 "   %10.2f %%  ternary hyper ternres", stats.htrs3, percent (stats.htrs3, stats.htrs));
   PRT ("  htr2:          %15" PRId64 "   %10.2f %%  binary hyper ternres", stats.htrs2, percent (stats.htrs2, stats.htrs));
   }
+  if (all || stats.unhide.count) {
+  PRT ("unhidden:        %15" PRId64 "   %10.2f    interval", stats.unhide.count, relative (stats.conflicts, stats.unhide.count));
+  PRT ("  unhiderounds:  %15" PRId64 "   %10.2f    per phase", stats.unhide.rounds, relative (stats.unhide.rounds, stats.unhide.count));
+  PRT ("  unhideunits:   %15" PRId64 "   %10.2f    per round", stats.unhide.units, relative (stats.unhide.units, stats.unhide.rounds));
+  PRT ("  unhidetauts:   %15" PRId64 "   %10.2f    per round", stats.unhide.tautologies, relative (stats.unhide.tautologies, stats.unhide.rounds));
+  PRT ("  unhidelits:    %15" PRId64 "   %10.2f    per round", stats.unhide.literals, relative (stats.unhide.literals, stats.unhide.rounds));
+  PRT ("  unhidetrds:    %15" PRId64 "   %10.2f    per round", stats.unhide.transitive, relative (stats.unhide.transitive, stats.unhide.rounds));
+  PRT ("  unhideticks:   %15" PRId64 "   %10.2f    per round", stats.unhide.ticks, relative (stats.unhide.ticks, stats.unhide.rounds));
+  }
   if (all || vivified) {
   PRT ("vivified:        %15" PRId64 "   %10.2f %%  of all clauses", vivified, percent (vivified, stats.added.total));
   PRT ("  vivifications: %15" PRId64 "   %10.2f    interval", stats.vivifications, relative (stats.conflicts, stats.vivifications));
@@ -280,6 +355,7 @@ void Internal::print_resource_usage () {
   MSG ("total process time since initialization: %12.2f    seconds", internal->process_time ());
   MSG ("total real time since initialization:    %12.2f    seconds", internal->real_time ());
   MSG ("maximum resident set size of process:    %12.2f    MB", m/(double)(1l<<20));
+  MSG ("current resident set size of process:    %12.2f    MB", current_resident_set_size ()/(double)(1l<<20));
 #endif
 }
 
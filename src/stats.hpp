@@ -54,6 +54,22 @@ struct Stats {
 
   struct { double process, real; } time;
 
+  struct {
+    int64_t count;      // number of backbone computations
+    int64_t calls;      // solver calls checking chunks of candidates
+    int64_t checked;    // backbone literals found by unsatisfiable calls
+    int64_t filtered;   // candidates falsified by models
+    int64_t fixed;      // backbone literals found root-level fixed
+  } backbone;
+
+  struct {
+    int64_t count;      // number of bounded variable addition rounds
+    int64_t vars;       // added variables
+    int64_t added;      // added clauses
+    int64_t removed;    // removed clauses
+    int64_t ticks;      // visited clauses during matching
+  } bva;
+
   struct {
     int64_t count;      // number of covered clause elimination rounds
     int64_t asymmetric; // number of asymmetric tautologies in CCE
@@ -61,6 +77,71 @@ struct Stats {
     int64_t total;      // total number of eliminated clauses
   } cover;
 
+  struct {
+    int64_t count;        // number of detection rounds
+    int64_t amos;         // detected at-most-one constraints
+    int64_t clauses;      // clauses used as cardinality constraints
+    int64_t resolvents;   // Fourier-Motzkin resolvents
+    int64_t kept;         // kept derived constraints
+    int64_t units;        // units derived
+    int64_t propagations; // propagated literals
+    int64_t conflicts;    // conflicting constraints
+    int64_t ticks;        // approximate number of literal visits
+  } card;
+
+  struct {
+    int64_t count;      // number of minimized failed assumption cores
+    int64_t original;   // failed assumptions before minimization
+    int64_t propagated; // failed assumptions removed by propagation
+    int64_t searched;   // failed assumptions removed by bounded search
+    int64_t tests;      // bounded search tests
+  } coremin;
+
+  struct {
+    int64_t checks;       // number of resident set size checks
+    int64_t reductions;   // forced reductions
+    int64_t flushes;      // forced flushes
+    int64_t exhausted;    // number of times limit reached
+  } memlimit;
+
+  struct {
+    int64_t count;        // number of sweeping rounds
+    int64_t gates;        // extracted AND gates
+    int64_t probes;       // probed candidate literals
+    int64_t equivalences; // found equivalences
+    int64_t units;        // found units
+    int64_t ticks;        // gate extraction and simulation ticks
+  } sweep;
+
+  struct {
+    int64_t count;        // number of unhiding phases
+    int64_t rounds;       // number of stamping rounds
+    int64_t units;        // failed literals
+    int64_t tautologies;  // removed hidden tautologies
+    int64_t literals;     // removed hidden literals
+    int64_t transitive;   // removed transitive binary clauses
+    int64_t ticks;        // traversed edges and clause literals
+  } unhide;
+
+  struct {
+    int64_t notified;   // assignments notified to external propagator
+    int64_t propagated; // literals propagated by external propagator
+    int64_t clauses;    // external (non-reason) clauses added
+    int64_t checks;     // models checked by external propagator
+    int64_t rejected;   // models rejected by external propagator
+  } extprop;
+
+  struct {
+    int64_t count;        // number of matrix extractions
+    int64_t xors;         // extracted XORs
+    int64_t matrices;     // non-trivial matrices
+    int64_t rows;         // rows of non-trivial matrices
+    int64_t units;        // units found during extraction
+    int64_t propagations; // propagated literals
+    int64_t conflicts;    // conflicting rows
+    int64_t ticks;        // approximate number of word operations
+  } gauss;
+
   struct {
     int64_t tried;
     int64_t succeeded;
@@ -102,6 +183,8 @@ struct Stats {
   int64_t reused;       // number of reused trails
   int64_t reusedlevels; // reused levels at restart
   int64_t reusedstable; // number of reused trails during stabilizing
+  int64_t reusedassume; // solve calls reusing assumption levels
+  int64_t reusedalevels;// reused assumption levels
   int64_t sections;     // 'section' counter
   int64_t chrono;       // chronological backtracks
   int64_t backtracks;   // number of backtracks
@@ -115,6 +198,8 @@ struct Stats {
   int64_t reduced;      // number of reduced clauses
   int64_t collected;    // number of collected bytes
   int64_t collections;  // number of garbage collections
+  int64_t arenamoving;  // number of moving arena garbage collections
+  int64_t arenamoved;   // number of bytes moved into the arena
   int64_t hbrs;         // hyper binary resolvents
   int64_t hbrsizes;     // sum of hyper resolved base clauses
   int64_t hbreds;       // redundant hyper binary resolvents
@@ -123,7 +208,7 @@ struct Stats {
   int64_t instantiated; // number of successful instantiations
   int64_t instrounds;   // number of instantiation rounds
   int64_t subsumed;     // number of subsumed clauses
-  int64_t deduplicated; // number of removed duplicated binary clauses
+  int64_t deduplicated; // number of removed duplicated clauses
   int64_t deduplications;//number of deduplication phases
   int64_t strengthened; // number of strengthened clauses
   int64_t elimotfstr;   // number of on-the-fly strengthened during elimination
@@ -132,6 +217,7 @@ struct Stats {
   int64_t subtried;     // number of tried subsumptions
   int64_t subchecks;    // number of pair-wise subsumption checks
   int64_t subchecks2;   // same but restricted to binary clauses
+  int64_t subfiltered;  // checks avoided by clause signatures
   int64_t elimotfsub;   // number of on-the-fly subsumed during elimination
   int64_t subsumerounds;// number of subsumption rounds
   int64_t subsumephases;// number of scheduled subsumption phases
@@ -190,6 +276,7 @@ struct Stats {
   int64_t failed;       // number of failed literals
   int64_t hyperunary;   // hyper unary resolved unit clauses
   int64_t probefailed;  // failed literals from probing
+  int64_t probetrees;   // trees visited in tree based probing
   int64_t transredunits;// units derived in transitive reduction
   int64_t blockings;    // number of blocked clause eliminations
   int64_t blocked;      // number of actually blocked clauses
@@ -57,6 +57,12 @@ namespace CaDiCaL {
 // literals which do not occur in the subsumed candidate fast with high
 // probability (less occurring literals have a higher chance).
 
+// Finally, each connected clause is stored together with a 64-bit Bloom
+// filter signature of its variables in the one-watch lists, as already in
+// SATeLite.  Most connected clauses traversed can then be rejected by
+// comparing signatures without dereferencing the clause, which on large
+// instances is the dominating cost of forward subsumption.
+
 bool Internal::subsuming () {
 
   if (!opts.subsume && !opts.vivify) return false;
@@ -172,14 +178,33 @@ void Internal::strengthen_clause (Clause * c, int lit) {
 
 /*------------------------------------------------------------------------*/
 
-// Find clauses connected in the occurrence lists 'occs' which subsume the
-// candidate clause 'c' given as first argument.  If this is the case the
-// clause is subsumed and the result is positive.   If the clause was
-// strengthened the result is negative.  Otherwise the candidate clause
-// can not be subsumed nor strengthened and zero is returned.
+// The signature of a clause sets for each of its variables one bit
+// determined by a multiplicative hash of the variable index.  Variables
+// and not literals are hashed since a strengthening clause contains one
+// literal in opposite phase (see 'SubsumeWatch' in 'subsume.hpp').
+
+inline uint64_t Internal::subsume_signature (Clause * c) {
+  uint64_t res = 0;
+  for (const auto & lit : *c) {
+    const uint64_t hash = (uint64_t) vidx (lit) * 0x9e3779b97f4a7c15ull;
+    res |= (uint64_t) 1 << (hash >> 58);
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Find clauses connected in the one-watch lists 'watched' which subsume
+// the candidate clause 'c' given as first argument with signature 'sig'.
+// If this is the case the clause is subsumed and the result is positive.
+// If the clause was strengthened the result is negative.  Otherwise the
+// candidate clause can not be subsumed nor strengthened and zero is
+// returned.
 
 inline int
-Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
+Internal::try_to_subsume_clause (Clause * c, uint64_t sig,
+                                 vector<SubsumeWatches> & watched,
+                                 vector<Clause *> & shrunken) {
 
   stats.subtried++;
   assert (!level);
@@ -241,12 +266,16 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
 
       // In this second loop we check for larger than binary clauses to
       // subsume or strengthen the candidate clause.   This is more costly,
-      // and needs a call to 'subsume_check'.  Otherwise the same contract
-      // as above for communicating 'subsumption' or 'strengthening' to the
-      // code after the loop is used.
+      // and needs a call to 'subsume_check', unless the signature of the
+      // connected clause shows that it contains a variable which does not
+      // occur in the candidate.  Otherwise the same contract as above for
+      // communicating 'subsumption' or 'strengthening' to the code after
+      // the loop is used.
       //
-      const Occs & os = occs (sign * lit);
-      for (const auto & e : os) {
+      const SubsumeWatches & ws = watched[vlit (sign * lit)];
+      for (const auto & w : ws) {
+        if (w.sig & ~sig) { stats.subfiltered++; continue; }
+        Clause * e = w.clause;
         assert (!e->garbage);                   // sanity check
         if (e->garbage) continue;               // defensive: not needed
         flipped = subsume_check (e, c);
@@ -282,12 +311,15 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
 
 // Sorting the scheduled clauses is way faster if we compute and save the
 // clause size in the schedule to avoid pointer access to clauses during
-// sorting.  This slightly increases the schedule size though.
+// sorting.  This slightly increases the schedule size though.  The clause
+// signature is computed while scheduling too.
 
 struct ClauseSize {
   size_t size;
+  uint64_t sig;
   Clause * clause;
-  ClauseSize (int s, Clause * c) : size (s), clause (c) { }
+  ClauseSize (int s, uint64_t g, Clause * c) :
+    size (s), sig (g), clause (c) { }
   ClauseSize () { }
 };
 
@@ -394,7 +426,7 @@ bool Internal::subsume_round () {
     }
 
     if (c->subsume) left_over_from_last_subsumption_round++;
-    schedule.push_back (ClauseSize (c->size, c));
+    schedule.push_back (ClauseSize (c->size, subsume_signature (c), c));
     for (const auto & lit : *c)
       noccs (lit)++;
   }
@@ -427,7 +459,7 @@ bool Internal::subsume_round () {
   int64_t subsumed = 0, strengthened = 0, checked = 0;
 
   vector<Clause *> shrunken;
-  init_occs ();
+  vector<SubsumeWatches> watched (2 * (max_var + 1));
   init_bins ();
 
   for (const auto & s : schedule) {
@@ -436,6 +468,7 @@ bool Internal::subsume_round () {
     if (stats.subchecks >= check_limit) break;
 
     Clause * c = s.clause;
+    uint64_t sig = s.sig;
     assert (!c->garbage);
 
     checked++;
@@ -450,9 +483,9 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      const int tmp = try_to_subsume_clause (c, sig, watched, shrunken);
       if (tmp > 0) { subsumed++; continue; }
-      if (tmp < 0) strengthened++;
+      if (tmp < 0) { strengthened++; sig = subsume_signature (c); }
     }
 
     // If not subsumed connect smallest occurring literal, where occurring
@@ -471,7 +504,8 @@ bool Internal::subsume_round () {
     for (const auto & lit : *c) {
 
       if (!flags (lit).subsume) subsume = false;
-      const size_t size = binary ? bins (lit).size () : occs (lit).size ();
+      const size_t size =
+        binary ? bins (lit).size () : watched[vlit (lit)].size ();
       if (minlit && minsize <= size) continue;
       const int64_t tmp = noccs (lit);
       if (minlit && minsize == size && tmp <= minoccs) continue;
@@ -494,7 +528,7 @@ bool Internal::subsume_round () {
       LOG (c, "watching %d with %zd current and total %" PRId64 " occurrences",
         minlit, minsize, minoccs);
 
-      occs (minlit).push_back (c);
+      watched[vlit (minlit)].push_back (SubsumeWatch (sig, c));
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -543,8 +577,8 @@ bool Internal::subsume_round () {
   // Release occurrence lists and schedule.
   //
   erase_vector (schedule);
+  erase_vector (watched);
   reset_noccs ();
-  reset_occs ();
   reset_bins ();
 
   // Reset all old 'added' flags and mark variables in shrunken
@@ -581,6 +615,11 @@ void Internal::subsume (bool update_limits) {
     return;
   }
 
+  // Remove exact duplicates first, which is cheap and also covers clauses
+  // not scheduled nor reached by the limited 'subsume_round'.
+  //
+  mark_duplicated_clauses_as_garbage ();
+
   if (opts.subsume) {
     reset_watches ();
     subsume_round ();
@@ -592,9 +631,12 @@ void Internal::subsume (bool update_limits) {
     }
   }
 
-  // Schedule 'vivification' in 'subsume' as well as 'transitive reduction'.
+  // Schedule 'vivification' in 'subsume' as well as 'unhiding' and
+  // 'transitive reduction'.  Unhiding removes most transitive binary
+  // clauses in linear time and thus leaves less work for 'transred'.
   //
   if (opts.vivify) vivify ();
+  if (opts.unhide) unhide ();
   if (opts.transred) transred ();
 
 UPDATE_LIMITS:
@@ -0,0 +1,32 @@
+#ifndef _subsume_hpp_INCLUDED
+#define _subsume_hpp_INCLUDED
+
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+struct Clause;
+
+// The one-watch occurrence lists in 'subsume.cpp' store together with each
+// connected clause its 64-bit signature, a Bloom filter over its variables
+// (each variable sets one bit).  The candidate clause can only be subsumed
+// or strengthened by a connected clause if all variables of the connected
+// clause also occur in the candidate.  Thus if the signature of the
+// connected clause has a bit set which is not set in the signature of the
+// candidate, then the connected clause can be skipped without accessing
+// its literals.
+
+struct SubsumeWatch {
+  uint64_t sig;                 // signature of the clause
+  Clause * clause;
+  SubsumeWatch (uint64_t s, Clause * c) : sig (s), clause (c) { }
+  SubsumeWatch () { }
+};
+
+typedef vector<SubsumeWatch> SubsumeWatches;
+
+}
+
+#endif
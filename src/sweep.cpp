@@ -0,0 +1,327 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Random simulation sweeping finds equivalent and constant literals which
+// are not visible in the binary implication graph (thus not found by
+// 'decompose') as it is common in miters of hardware verification problems.
+// We first extract AND gates from the irredundant clauses and then simulate
+// them in topological order on random input patterns.  Each variable gets
+// a signature of 'sweepwords' 64-bit words, which are computed word by
+// word with bit-wise operations, thus simulating 64 patterns per word (the
+// inner loops over the words are simple enough to be vectorized by the
+// compiler).  Literals with the same (normalized) signature are candidates
+// for being equivalent and literals with a zero signature are candidates
+// for being false.  Gates on cycles are simulated anyhow, since signatures
+// are only used to generate candidates.  Gate extraction is bounded by
+// the same effort in 'stats.sweep.ticks' as probing in propagations and
+// simulation is linear in the size of the extracted gates.
+//
+// Candidates are then checked by failed literal probing with the same
+// propagation as in 'probe.cpp'.  A literal candidate for being false is
+// probed and yields a unit if the probe fails.  For the candidates in one
+// equivalence class we probe the representative (the literal of the
+// smallest variable) in both phases.  If the representative implies a
+// member and its negation the negation of the member, both implications
+// are added as binary clauses (which are derived by unit propagation).  The
+// equivalences are then substituted by 'decompose' right after sweeping.
+
+/*------------------------------------------------------------------------*/
+
+Sweeper::Sweeper (Internal * i, unsigned w) : internal (i), words (w) { }
+
+inline bool sweep_less_signature::operator () (int a, int b) const {
+  const uint64_t * s = sweeper->sig (abs (a));
+  const uint64_t * t = sweeper->sig (abs (b));
+  for (unsigned i = 0; i < sweeper->words; i++)
+    if (s[i] != t[i]) return s[i] < t[i];
+  return abs (a) < abs (b);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Find AND gates 'lit = -other_1 & ... & -other_k' encoded by the clause
+// 'lit | other_1 | ... | other_k' and the binary clauses '-lit | -other_i'.
+// Each variable gets at most one gate (the first one found).  Extraction
+// stops as soon as 'stats.sweep.ticks' exceeds the given limit.
+
+void Internal::sweep_extract_gates (Sweeper & sweeper, int64_t limit) {
+
+  init_occs ();
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->redundant) continue;
+    if (c->size < 3) continue;
+    if (c->size > opts.sweepclslim) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    for (const auto & lit : *c)
+      occs (lit).push_back (c);
+    stats.sweep.ticks += c->size;
+  }
+
+  sweeper.lhs.resize (1 + (size_t) max_var, 0);
+  sweeper.begin.resize (1 + (size_t) max_var, 0);
+
+  for (auto idx : vars) {
+    if (stats.sweep.ticks > limit) {
+      LOG ("gate extraction hit ticks limit");
+      break;
+    }
+    if (!active (idx)) continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      if (sweeper.lhs[idx]) break;
+      const int lit = sign * idx;
+      if (occs (lit).empty ()) continue;
+      for (const auto & w : watches (-lit)) {
+        stats.sweep.ticks++;
+        if (w.binary () && !marked (w.blit)) mark (w.blit);
+      }
+      for (const auto & c : occs (lit)) {
+        stats.sweep.ticks++;
+        bool gate = true;
+        for (const auto & other : *c)
+          if (other != lit && marked (-other) <= 0) { gate = false; break; }
+        if (!gate) continue;
+        LOG (c, "found AND gate with output %d in", lit);
+        sweeper.lhs[idx] = lit;
+        sweeper.begin[idx] = sweeper.inputs.size ();
+        for (const auto & other : *c)
+          if (other != lit) sweeper.inputs.push_back (-other);
+        sweeper.inputs.push_back (0);
+        stats.sweep.gates++;
+        break;
+      }
+      for (const auto & w : watches (-lit))
+        if (w.binary ()) unmark (w.blit);
+    }
+  }
+
+  reset_occs ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Simulate all gates on random patterns in topological order (determined
+// by depth-first search, where negative stack entries denote finished
+// variables).  Gate outputs on cycles keep their random signature.
+
+void Internal::sweep_simulate (Sweeper & sweeper) {
+
+  const unsigned words = sweeper.words;
+
+  Random random (opts.seed);
+  random += stats.sweep.count;
+  sweeper.sigs.resize ((1 + (size_t) max_var) * words);
+  for (auto & w : sweeper.sigs)
+    w = random.next ();
+
+  vector<signed char> state (1 + (size_t) max_var, 0);
+  vector<int> stack;
+  for (auto root : vars) {
+    if (!sweeper.lhs[root]) continue;
+    if (state[root]) continue;
+    stack.push_back (root);
+    while (!stack.empty ()) {
+      const int idx = stack.back ();
+      stack.pop_back ();
+      if (idx < 0) {
+        state[-idx] = 2;
+        sweeper.order.push_back (-idx);
+      } else if (!state[idx]) {
+        state[idx] = 1;
+        stack.push_back (-idx);
+        const int * p = &sweeper.inputs[sweeper.begin[idx]];
+        for (; *p; p++) {
+          const int other = abs (*p);
+          if (sweeper.lhs[other] && !state[other]) stack.push_back (other);
+        }
+      }
+    }
+  }
+
+  vector<uint64_t> acc (words);
+  for (const auto & idx : sweeper.order) {
+    for (unsigned i = 0; i < words; i++)
+      acc[i] = ~(uint64_t) 0;
+    for (const int * p = &sweeper.inputs[sweeper.begin[idx]]; *p; p++) {
+      const uint64_t * s = sweeper.sig (abs (*p));
+      const uint64_t mask = *p < 0 ? ~(uint64_t) 0 : 0;
+      for (unsigned i = 0; i < words; i++)
+        acc[i] &= s[i] ^ mask;
+    }
+    uint64_t * s = sweeper.sig (idx);
+    const uint64_t mask = sweeper.lhs[idx] < 0 ? ~(uint64_t) 0 : 0;
+    for (unsigned i = 0; i < words; i++)
+      s[i] = acc[i] ^ mask;
+  }
+
+  stats.sweep.ticks += sweeper.sigs.size ();
+  stats.sweep.ticks += sweeper.inputs.size () * (size_t) (words + 1);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Add the binary clause 'a | b' derived by propagating during probing.
+
+void Internal::sweep_add_binary (int a, int b) {
+  assert (clause.empty ());
+  assert (!level);
+  clause.push_back (a);
+  clause.push_back (b);
+  LOG (clause, "sweeping implication");
+  new_hyper_binary_resolved_clause (true, 2);
+  clause.clear ();
+}
+
+// Probe a literal candidate for being false.
+
+void Internal::sweep_constant (int lit) {
+  if (val (lit)) return;
+  stats.sweep.probes++;
+  probe_assign_decision (lit);
+  if (probe_propagate ()) { backtrack (); return; }
+  failed_literal (lit);
+  stats.sweep.units++;
+}
+
+// Check which literals of an equivalence class are equivalent to the
+// first literal by probing it in both phases.
+
+void Internal::sweep_equivalences (const vector<int> & lits) {
+
+  const int repr = lits[0];
+  if (val (repr)) return;
+
+  vector<int> implied;
+
+  stats.sweep.probes++;
+  probe_assign_decision (repr);
+  if (!probe_propagate ()) { failed_literal (repr); return; }
+  for (size_t i = 1; i < lits.size (); i++)
+    if (val (lits[i]) > 0 && var (lits[i]).level)
+      implied.push_back (lits[i]);
+  backtrack ();
+
+  if (implied.empty ()) return;
+
+  stats.sweep.probes++;
+  probe_assign_decision (-repr);
+  if (!probe_propagate ()) { failed_literal (-repr); return; }
+  const auto end = implied.end ();
+  auto j = implied.begin ();
+  for (auto i = j; i != end; i++)
+    if (val (*i) < 0) *j++ = *i;
+  implied.resize (j - implied.begin ());
+  backtrack ();
+
+  for (const auto & lit : implied) {
+    if (val (repr) || val (lit)) break;
+    LOG ("sweeping found %d equivalent to %d", lit, repr);
+    sweep_add_binary (-repr, lit);
+    sweep_add_binary (repr, -lit);
+    stats.sweep.equivalences++;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::sweep () {
+
+  if (!opts.sweep) return false;
+  if (unsat) return false;
+  if (terminated_asynchronously ()) return false;
+
+  assert (!level);
+  assert (propagated == trail.size ());
+
+  START_SIMPLIFIER (sweep, PROBE);
+  stats.sweep.count++;
+
+  int64_t delta = stats.propagations.search;
+  delta *= 1e-3 * opts.sweepreleff;
+  if (delta < opts.sweepmineff) delta = opts.sweepmineff;
+  if (delta > opts.sweepmaxeff) delta = opts.sweepmaxeff;
+  const int64_t limit = stats.propagations.probe + delta;
+
+  const int64_t old_equivalences = stats.sweep.equivalences;
+  const int64_t old_units = stats.sweep.units;
+
+  Sweeper sweeper (this, opts.sweepwords);
+  sweep_extract_gates (sweeper, stats.sweep.ticks + delta);
+  sweep_simulate (sweeper);
+
+  // Normalize signatures such that the first pattern is zero.
+
+  vector<int> candidates;
+  for (auto idx : vars) {
+    if (!active (idx)) continue;
+    uint64_t * s = sweeper.sig (idx);
+    int lit = idx;
+    if (s[0] & 1) {
+      for (unsigned i = 0; i < sweeper.words; i++)
+        s[i] = ~s[i];
+      lit = -idx;
+    }
+    candidates.push_back (lit);
+  }
+
+  sort (candidates.begin (), candidates.end (),
+    sweep_less_signature (&sweeper));
+
+  PHASE ("sweep", stats.sweep.count,
+    "simulated %zd gates on %u patterns to sort %zd candidates",
+    sweeper.order.size (), 64 * sweeper.words, candidates.size ());
+
+  propagated = propagated2 = trail.size ();
+
+  vector<int> lits;
+  const auto end = candidates.end ();
+  auto i = candidates.begin ();
+  while (!unsat &&
+         !terminated_asynchronously () &&
+         stats.propagations.probe < limit &&
+         i != end) {
+    const uint64_t * s = sweeper.sig (abs (*i));
+    bool zero = true;
+    for (unsigned k = 0; zero && k < sweeper.words; k++)
+      zero = !s[k];
+    lits.clear ();
+    do lits.push_back (*i++);
+    while (i != end &&
+           !memcmp (s, sweeper.sig (abs (*i)), 8 * sweeper.words));
+    if (zero)
+      for (const auto & lit : lits)
+        sweep_constant (lit);
+    else if (lits.size () > 1)
+      sweep_equivalences (lits);
+  }
+
+  if (unsat) LOG ("sweeping derived empty clause");
+  else if (propagated < trail.size ()) {
+    if (!propagate ()) {
+      LOG ("propagating units after sweeping results in empty clause");
+      learn_empty_clause ();
+    }
+  }
+
+  const int64_t equivalences = stats.sweep.equivalences - old_equivalences;
+  const int64_t units = stats.sweep.units - old_units;
+
+  PHASE ("sweep", stats.sweep.count,
+    "found %" PRId64 " equivalences and %" PRId64 " units",
+    equivalences, units);
+
+  STOP_SIMPLIFIER (sweep, PROBE);
+
+  report ('w', !opts.reportall && !(equivalences + units));
+
+  return equivalences;
+}
+
+}
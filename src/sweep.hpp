@@ -0,0 +1,35 @@
+#ifndef _sweep_hpp_INCLUDED
+#define _sweep_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+struct Internal;
+
+// Extracted AND gates and their simulation signatures used for finding
+// equivalent and constant literal candidates in 'sweep.cpp'.
+
+struct Sweeper {
+
+  Internal * internal;
+  const unsigned words;         // simulation words per variable
+
+  vector<int> lhs;              // gate output literal of each variable
+  vector<unsigned> begin;       // gate inputs start in 'inputs'
+  vector<int> inputs;           // zero terminated gate inputs
+  vector<int> order;            // gate variables in topological order
+  vector<uint64_t> sigs;        // simulation signatures of variables
+
+  Sweeper (Internal *, unsigned words);
+
+  uint64_t * sig (int idx) { return &sigs[(size_t) idx * words]; }
+};
+
+struct sweep_less_signature {
+  Sweeper * sweeper;
+  sweep_less_signature (Sweeper * s) : sweeper (s) { }
+  bool operator () (int a, int b) const;
+};
+
+}
+
+#endif
@@ -58,10 +58,13 @@ void Internal::transred () {
     i = clauses.begin ();
   }
 
-  // Move watches of binary clauses to the front. Thus we can stop iterating
-  // watches as soon a long clause is found during watch traversal.
+  // Take a snapshot of the binary implication graph including redundant
+  // binary clauses.  Thus the search only visits binary edges and does not
+  // need to skip watches of larger clauses.  Clauses removed below are
+  // still in the snapshot but marked as garbage.
   //
-  sort_watches ();
+  BinGraph graph;
+  init_bin_graph (graph, true);
 
   // This working stack plays the same role as the 'trail' during standard
   // propagation.
@@ -95,12 +98,12 @@ void Internal::transred () {
     // Find a different path from 'src' to 'dst' in the binary implication
     // graph, not using 'c'.  Since this is the same as checking whether
     // there is a path from '-dst' to '-src', we can do the reverse search
-    // if the number of watches of '-dst' is larger than those of 'src'.
+    // if the out-degree of '-dst' is larger than the one of 'src'.
     //
     int src = -c->literals[0];
     int dst = c->literals[1];
     if (val (src) || val (dst)) continue;
-    if (watches (-src).size () < watches (dst).size ()) {
+    if (graph.degree (vlit (src)) < graph.degree (vlit (-dst))) {
       int tmp = dst;
       dst = -src; src = -tmp;
     }
@@ -128,17 +131,15 @@ void Internal::transred () {
       assert (marked (lit) > 0);
       LOG ("transred propagating %d", lit);
       propagations++;
-      const Watches & ws = watches (-lit);
-      const const_watch_iterator eow = ws.end ();
-      const_watch_iterator k;
-      for (k = ws.begin (); !transitive && !failed && k != eow; k++) {
-        const Watch & w = *k;
-        if (!w.binary ()) break;        // since we sorted watches above
-        Clause * d = w.clause;
+      const unsigned u = vlit (lit);
+      const size_t eoe = graph.end (u);
+      for (size_t k = graph.begin (u);
+           !transitive && !failed && k != eoe; k++) {
+        Clause * d = graph.reasons[k];
         if (d == c) continue;
         if (irredundant && d->redundant) continue;
         if (d->garbage) continue;
-        const int other = w.blit;
+        const int other = graph.targets[k];
         if (other == dst) transitive = true;    // 'dst' reached
         else {
           const int tmp = marked (other);
@@ -184,6 +185,7 @@ void Internal::transred () {
   last.transred.propagations = stats.propagations.search;
   stats.propagations.transred += propagations;
   erase_vector (work);
+  erase_bin_graph (graph);
 
   PHASE ("transred", stats.transreds,
     "removed %" PRId64 " transitive clauses, found %" PRId64 " units",
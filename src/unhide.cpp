@@ -0,0 +1,405 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Unhiding following 'Efficient CNF Simplification Based on Binary
+// Implication Graphs' by Heule, Jarvisalo and Biere [SAT'11].  A depth
+// first search over the binary implication graph (BIG) of the irredundant
+// binary clauses assigns discovery and finish time stamps to all literals.
+// If the time stamp interval of 'u' contains the interval of 'v' then 'v'
+// is reachable from 'u' in the BIG and thus 'u' implies 'v'.  The converse
+// does not hold, since only the tree edges are captured by the intervals.
+// Thus stamping gives a cheap but incomplete implication check, which is
+// used for the following simplifications all in (almost) linear time:
+//
+//   hidden tautology elimination (HTE): remove clauses containing two
+//   literals 'a' and 'b' where '-a' implies 'b'
+//
+//   hidden literal elimination (HLE): remove a literal 'a' from a clause
+//   if 'a' implies another literal 'b' of that clause
+//
+//   failed literal detection (FLD): learn '-a' if 'a' implies both 'b'
+//   and '-b', found during stamping
+//
+//   transitive reduction (TRD): remove a binary clause '-a | b' if 'b' is
+//   reachable from 'a' without using it, also found during stamping
+//
+// For stamping we use the 'advanced stamping' algorithm of the paper which
+// also merges strongly connected components (by giving all its literals
+// the same time stamps) and made iterative here.  Each round starts the
+// depth-first search at the roots of the BIG in random order.  This makes
+// it complementary to 'transred', which is bounded by its efficiency limit
+// on large BIGs and to 'decompose' which only finds equivalences.
+
+/*------------------------------------------------------------------------*/
+
+// Stamp all literals reachable from 'start' (Algorithm 2 in the paper).
+// Edges are taken from the snapshot of the irredundant binary implication
+// graph, which contains binary clauses removed as transitive in the mean
+// time as garbage clauses.
+
+void Internal::unhide_stamp (Unhider & unhider, int start) {
+
+  assert (!val (start));
+  assert (!unhider.dsc[vlit (start)]);
+  assert (unhider.frames.empty ());
+
+  auto & dsc = unhider.dsc;
+  auto & fin = unhider.fin;
+  auto & obs = unhider.obs;
+  auto & prt = unhider.prt;
+  auto & root = unhider.root;
+
+  const unsigned us = vlit (start);
+  unhider.frames.push_back (UnhideFrame (start, unhider.graph.begin (us)));
+  unhider.scc.push_back (start);
+  dsc[us] = obs[us] = ++unhider.stamp;
+  prt[us] = root[us] = start;
+
+  while (!unhider.frames.empty ()) {
+
+    UnhideFrame & frame = unhider.frames.back ();
+    const int lit = frame.lit;
+    const unsigned ul = vlit (lit);
+
+    // Returned from stamping 'child' which was reached from 'lit'.
+    //
+    if (frame.child) {
+      const unsigned uc = vlit (frame.child);
+      frame.child = 0;
+      if (!fin[uc] && dsc[uc] < dsc[ul]) {
+        dsc[ul] = dsc[uc];
+        frame.flag = false;
+      }
+      obs[uc] = unhider.stamp;
+    }
+
+    bool descended = false;
+    const size_t end = unhider.graph.end (ul);
+    while (frame.pos < end) {
+      const size_t pos = frame.pos++;
+      Clause * c = unhider.graph.reasons[pos];
+      if (c->garbage) continue;
+      const int other = unhider.graph.targets[pos];
+      if (val (other)) continue;
+      stats.unhide.ticks++;
+      const unsigned uo = vlit (other);
+      const unsigned un = vlit (-other);
+
+      if (dsc[ul] < obs[uo]) {
+        LOG (c, "unhiding transitive");
+        stats.unhide.transitive++;
+        mark_garbage (c);
+        continue;
+      }
+
+      if (dsc[vlit (root[ul])] <= obs[un]) {
+        int failed = lit;
+        while (dsc[vlit (failed)] > obs[un])
+          failed = prt[vlit (failed)];
+        LOG ("unhiding failed literal %d", failed);
+        unhider.units.push_back (-failed);
+        if (dsc[un] && !fin[un]) continue;
+      }
+
+      if (!dsc[uo]) {
+        prt[uo] = lit;
+        root[uo] = root[ul];
+        frame.child = other;
+        const size_t begin = unhider.graph.begin (uo);
+        unhider.frames.push_back (UnhideFrame (other, begin));
+        unhider.scc.push_back (other);
+        dsc[uo] = obs[uo] = ++unhider.stamp;
+        descended = true;
+        break;
+      }
+
+      if (!fin[uo] && dsc[uo] < dsc[ul]) {
+        dsc[ul] = dsc[uo];
+        frame.flag = false;
+      }
+      obs[uo] = unhider.stamp;
+    }
+    if (descended) continue;
+
+    // All literals on the SCC stack above and including 'lit' form a
+    // strongly connected component and get the same time stamps.
+    //
+    if (frame.flag) {
+      unhider.stamp++;
+      int other;
+      do {
+        other = unhider.scc.back ();
+        unhider.scc.pop_back ();
+        dsc[vlit (other)] = dsc[ul];
+        fin[vlit (other)] = unhider.stamp;
+      } while (other != lit);
+    }
+
+    unhider.frames.pop_back ();
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Stamp all active literals, first starting at roots of the BIG, which are
+// the literals without incoming edges (their negation has no outgoing
+// edges) in random order, then the remaining ones (on cycles).
+
+void Internal::unhide_stamp_all (Unhider & unhider) {
+
+  Random random (opts.seed);
+  random += stats.unhide.rounds;
+
+  vector<int> roots, others;
+  for (auto idx : vars) {
+    if (!active (idx)) continue;
+    if (val (idx)) continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (unhider.graph.degree (vlit (-lit))) others.push_back (lit);
+      else roots.push_back (lit);
+    }
+  }
+
+  for (auto * lits : { &roots, &others }) {
+    const int size = lits->size ();
+    for (int i = 0; i + 1 < size; i++) {
+      const int j = random.pick_int (i, size - 1);
+      swap ((*lits)[i], (*lits)[j]);
+    }
+    for (const auto & lit : *lits)
+      if (!unhider.dsc[vlit (lit)])
+        unhide_stamp (unhider, lit);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// The stamps of 'a' contain those of 'b' or those of '-b' contain those of
+// '-a', thus 'b' is reachable from 'a' in the depth-first search.
+
+bool Internal::unhide_implies (Unhider & unhider, int a, int b) {
+  const auto & dsc = unhider.dsc;
+  const auto & fin = unhider.fin;
+  const unsigned ua = vlit (a), ub = vlit (b);
+  if (dsc[ua] <= dsc[ub] && fin[ub] <= fin[ua]) return true;
+  const unsigned na = vlit (-a), nb = vlit (-b);
+  return dsc[nb] <= dsc[na] && fin[na] <= fin[nb];
+}
+
+// Check whether 'c' is a hidden tautology.  The negations of its literals
+// and its literals are both sorted by discovery time.  Then we check in one
+// merge like pass whether the interval of a negated literal contains the
+// interval of a literal.
+
+bool Internal::unhide_hte (Unhider & unhider, Clause * c,
+                           vector<int> & neg, vector<int> & pos) {
+
+  const auto & dsc = unhider.dsc;
+  const auto & fin = unhider.fin;
+
+  auto less_dsc = [&] (int a, int b) {
+    return dsc[vlit (a)] < dsc[vlit (b)];
+  };
+
+  neg.clear ();
+  pos.clear ();
+  for (const auto & lit : *c) {
+    neg.push_back (-lit);
+    pos.push_back (lit);
+  }
+  sort (neg.begin (), neg.end (), less_dsc);
+  sort (pos.begin (), pos.end (), less_dsc);
+
+  auto n = neg.begin (), p = pos.begin ();
+  for (;;) {
+    const unsigned un = vlit (*n), up = vlit (*p);
+    if (dsc[un] > dsc[up]) {
+      if (++p == pos.end ()) return false;
+    } else if (fin[un] < fin[up]) {
+      if (++n == neg.end ()) return false;
+    } else {
+      LOG (c, "unhiding %d implies %d in hidden tautology", *n, *p);
+      return true;
+    }
+  }
+}
+
+// Remove hidden literals of 'c' which imply another literal of 'c'.  As
+// 'strengthen_clause' requires clauses of size at least three, we do not
+// shrink clauses below binary clauses.
+
+void Internal::unhide_hle (Unhider & unhider, Clause * c,
+                           vector<int> & neg, vector<int> & pos) {
+
+  const auto & dsc = unhider.dsc;
+  const auto & fin = unhider.fin;
+
+  vector<int> & removed = unhider.units;
+  assert (removed.empty ());
+
+  // Literals by decreasing discovery time, thus implied literals first.
+  //
+  pos.clear ();
+  for (const auto & lit : *c)
+    pos.push_back (lit);
+  sort (pos.begin (), pos.end (), [&] (int a, int b) {
+    return dsc[vlit (a)] > dsc[vlit (b)];
+  });
+  int64_t finished = fin[vlit (pos[0])];
+  for (size_t i = 1; i < pos.size (); i++) {
+    const int lit = pos[i];
+    const int64_t tmp = fin[vlit (lit)];
+    if (tmp > finished) removed.push_back (lit);
+    else finished = tmp;
+  }
+
+  // Negations of literals by increasing discovery time.
+  //
+  neg.clear ();
+  for (const auto & lit : *c)
+    neg.push_back (-lit);
+  sort (neg.begin (), neg.end (), [&] (int a, int b) {
+    return dsc[vlit (a)] < dsc[vlit (b)];
+  });
+  finished = fin[vlit (neg[0])];
+  for (size_t i = 1; i < neg.size (); i++) {
+    const int lit = neg[i];
+    const int64_t tmp = fin[vlit (lit)];
+    if (tmp < finished) removed.push_back (-lit);
+    else finished = tmp;
+  }
+
+  // Both passes consider implications independently, thus literals
+  // implying each other (with the same or contained time stamps) might
+  // both be candidates.  We only remove a literal if an implied literal
+  // is still in the clause.
+
+  for (const auto & lit : removed) {
+    if (c->size < 3) break;
+    bool found = false, implied = false;
+    for (const auto & other : *c)
+      if (other == lit) found = true;
+      else if (!implied) implied = unhide_implies (unhider, lit, other);
+    if (!found || !implied) continue;
+    LOG (c, "unhiding hidden literal %d in", lit);
+    stats.unhide.literals++;
+    strengthen_clause (c, lit);
+  }
+  removed.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// One unhiding round: stamp, learn failed literals and then remove hidden
+// tautologies and hidden literals from all unassigned clauses.
+
+void Internal::unhide_round () {
+
+  stats.unhide.rounds++;
+
+  Unhider unhider (2 * vsize);
+  init_bin_graph (unhider.graph, false);
+  unhide_stamp_all (unhider);
+
+  PHASE ("unhide", stats.unhide.count,
+    "stamped %" PRId64 " time stamps with %zd failed literals",
+    unhider.stamp, unhider.units.size ());
+
+  for (const auto & lit : unhider.units) {
+    const int tmp = val (lit);
+    if (tmp > 0) continue;
+    if (tmp < 0) {
+      LOG ("unhiding failed literal %d already assigned", -lit);
+      learn_empty_clause ();
+      return;
+    }
+    stats.failed++;
+    stats.unhide.units++;
+    assign_unit (lit);
+    if (!propagate ()) {
+      LOG ("propagating unhiding unit %d results in empty clause", lit);
+      learn_empty_clause ();
+      return;
+    }
+  }
+  unhider.units.clear ();
+
+  vector<int> neg, pos;
+
+  reset_watches ();
+
+  const size_t size = clauses.size ();
+  for (size_t i = 0; i < size; i++) {
+    Clause * c = clauses[i];
+    if (c->garbage) continue;
+    if (c->size < 3) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    stats.unhide.ticks += c->size;
+    if (unhide_hte (unhider, c, neg, pos)) {
+      stats.unhide.tautologies++;
+      mark_garbage (c);
+    } else unhide_hle (unhider, c, neg, pos);
+  }
+
+  init_watches ();
+  connect_watches ();
+
+  if (!propagate ()) {
+    LOG ("propagation after unhiding results in empty clause");
+    learn_empty_clause ();
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::unhide () {
+
+  if (unsat) return;
+  if (terminated_asynchronously ()) return;
+  if (!stats.current.irredundant) return;
+
+  assert (opts.unhide);
+  assert (!level);
+
+  if (propagated < trail.size () && !propagate ()) {
+    LOG ("propagating units results in empty clause");
+    learn_empty_clause ();
+    return;
+  }
+
+  START_SIMPLIFIER (unhide, UNHIDE);
+  stats.unhide.count++;
+
+  const int64_t old_units = stats.unhide.units;
+  const int64_t old_tautologies = stats.unhide.tautologies;
+  const int64_t old_literals = stats.unhide.literals;
+  const int64_t old_transitive = stats.unhide.transitive;
+
+  for (int round = 0;
+       !unsat && !terminated_asynchronously () && round < opts.unhiderounds;
+       round++)
+    unhide_round ();
+
+  const int64_t units = stats.unhide.units - old_units;
+  const int64_t tautologies = stats.unhide.tautologies - old_tautologies;
+  const int64_t literals = stats.unhide.literals - old_literals;
+  const int64_t transitive = stats.unhide.transitive - old_transitive;
+
+  PHASE ("unhide", stats.unhide.count,
+    "found %" PRId64 " units, %" PRId64 " hidden tautologies, %" PRId64
+    " hidden literals and %" PRId64 " transitive clauses",
+    units, tautologies, literals, transitive);
+
+  STOP_SIMPLIFIER (unhide, UNHIDE);
+  report ('u', !opts.reportall && !(units + tautologies + literals +
+                                    transitive));
+}
+
+}
@@ -0,0 +1,42 @@
+#ifndef _unhide_hpp_INCLUDED
+#define _unhide_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Time stamps of the depth-first search over the binary implication graph
+// in 'unhide.cpp'.  All literal tables are indexed by 'vlit'.
+
+struct UnhideFrame {
+  int lit;                      // literal on the depth-first search stack
+  size_t pos;                   // next edge of 'lit' to traverse
+  bool flag;                    // 'lit' is representative of its SCC
+  int child;                    // returned from stamping this literal
+  UnhideFrame (int l, size_t p) :
+    lit (l), pos (p), flag (true), child (0) { }
+};
+
+struct Unhider {
+
+  BinGraph graph;               // irredundant binary implication graph
+  int64_t stamp;                // last used time stamp
+
+  vector<int64_t> dsc;          // discovery time stamps
+  vector<int64_t> fin;          // finish time stamps
+  vector<int64_t> obs;          // last time a literal was observed
+  vector<int> prt;              // parent literal in depth-first tree
+  vector<int> root;             // root literal of depth-first tree
+
+  vector<int> scc;              // literals of open SCCs
+  vector<int> units;            // negations of found failed literals
+  vector<UnhideFrame> frames;   // depth-first search stack
+
+  Unhider (size_t size) :
+    stamp (0),
+    dsc (size, 0), fin (size, 0), obs (size, 0),
+    prt (size, 0), root (size, 0)
+  { }
+};
+
+}
+
+#endif
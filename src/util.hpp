@@ -79,8 +79,8 @@ inline bool parity (unsigned a) {
 // allocated size of watched and occurrence lists small particularly during
 // bounded variable elimination where many clauses are added and removed.
 
-template<class T> void erase_vector (vector<T> & v) {
-  if (v.capacity ()) { std::vector<T>().swap (v); }
+template<class T, class A> void erase_vector (vector<T, A> & v) {
+  if (v.capacity ()) { std::vector<T, A>(v.get_allocator ()).swap (v); }
   assert (!v.capacity ());                          // not guaranteed though
 }
 
@@ -88,11 +88,21 @@ template<class T> void erase_vector (vector<T> & v) {
 // capacity of a vector to its size thus kind of releasing all the internal
 // excess memory not needed at the moment any more.
 
-template<class T> void shrink_vector (vector<T> & v) {
-  if (v.capacity () > v.size ()) { vector<T>(v).swap (v); }
+template<class T, class A> void shrink_vector (vector<T, A> & v) {
+  if (v.capacity () > v.size ()) { vector<T, A>(v).swap (v); }
   assert (v.capacity () == v.size ());              // not guaranteed though
 }
 
+// Bytes allocated for the elements of a vector (its capacity).
+
+template<class T, class A> size_t bytes_vector (const vector<T, A> & v) {
+  return v.capacity () * sizeof (T);
+}
+
+inline size_t bytes_vector (const vector<bool> & v) {
+  return (v.capacity () + 7) / 8;
+}
+
 /*------------------------------------------------------------------------*/
 
 template<class T>
@@ -5,6 +5,23 @@ namespace CaDiCaL {
 /*------------------------------------------------------------------------*/
 
 // Random walk local search based on 'ProbSAT' ideas.
+//
+// As in 'ProbSAT' the break values are maintained incrementally.  For each
+// clause we keep the number of its true literals and the exclusive-or of
+// these literals, which gives the single true literal (called 'critical')
+// if there is exactly one.  The break value of a variable is the number
+// of clauses in which its true literal is critical.  Flipping a literal
+// updates these counters for all clauses in which the variable occurs
+// (through full occurrence lists in compressed sparse row format), and
+// picking a literal from a broken clause only needs to look up the break
+// values of its literals.  Broken clauses remember their position on the
+// 'broken' stack to remove them in constant time when they are made.
+//
+// The literals of the considered clauses are copied at the start of each
+// round into one flat read-only array, so local search neither touches
+// the clauses nor the watches of the CDCL solver (and in particular does
+// not change the order of literals in clauses).  Clauses are referenced
+// by their index in this array.
 
 struct Walker {
 
@@ -13,13 +30,33 @@ struct Walker {
   Random random;                // local random number generator
   int64_t propagations;         // number of propagations
   int64_t limit;                // limit on number of propagations
-  vector <Clause *> broken;     // currently unsatisfied clauses
+  double ratio;                 // occurrences per propagation
+  vector<int> literals;         // literals of considered clauses
+  vector<size_t> starts;        // start of clauses in 'literals'
+  vector<unsigned> counts;      // number of true literals of clauses
+  vector<int> criticals;        // exclusive-or of true literals
+  vector<unsigned> positions;   // position of broken clauses on 'broken'
+  vector<unsigned> broken;      // currently unsatisfied clauses
+  vector<unsigned> breaks;      // break values of variables
+  vector<size_t> offsets;       // start of occurrences of each literal
+  vector<unsigned> occs;        // clauses in which literals occur
   double epsilon;               // smallest considered score
   vector<double> table;         // break value to score table
   vector<double> scores;        // scores of candidate literals
 
   double score (unsigned);      // compute score from break count
 
+  void push_broken (unsigned);  // register broken clause
+  void pop_broken (unsigned);   // remove made clause
+
+  size_t size_clauses () const { return starts.size () - 1; }
+  const int * begin (unsigned i) const {
+    return literals.data () + starts[i];
+  }
+  const int * end (unsigned i) const {
+    return literals.data () + starts[i + 1];
+  }
+
   Walker (Internal *, double size, int64_t limit);
 };
 
@@ -67,7 +104,8 @@ Walker::Walker (Internal * i, double size, int64_t l) :
   internal (i),
   random (internal->opts.seed),         // global random seed
   propagations (0),
-  limit (l)
+  limit (l),
+  ratio (max (1.0, internal->clause_variable_ratio ()))
 {
   random += internal->stats.walk.count; // different seed every time
 
@@ -97,82 +135,39 @@ inline double Walker::score (unsigned i) {
   return res;
 }
 
+inline void Walker::push_broken (unsigned i) {
+  LOG ("clause[%u] broken", i);
+  positions[i] = broken.size ();
+  broken.push_back (i);
+}
+
+inline void Walker::pop_broken (unsigned i) {
+  LOG ("clause[%u] made", i);
+  const unsigned pos = positions[i];
+  assert (pos < broken.size ());
+  assert (broken[pos] == i);
+  const unsigned last = broken.back ();
+  broken[pos] = last;
+  positions[last] = pos;
+  broken.pop_back ();
+}
+
 /*------------------------------------------------------------------------*/
 
-Clause * Internal::walk_pick_clause (Walker & walker) {
+unsigned Internal::walk_pick_clause (Walker & walker) {
   require_mode (WALK);
   assert (!walker.broken.empty ());
   int64_t size = walker.broken.size ();
   if (size > INT_MAX) size = INT_MAX;
   int pos = walker.random.pick_int (0, size-1);
-  Clause * res = walker.broken[pos];
-  LOG (res, "picking random position %d", pos);
-  return res;
-}
-
-/*------------------------------------------------------------------------*/
-
-// Compute the number of clauses which would be become unsatisfied if 'lit'
-// is flipped and set to false.  This is called the 'break-count' of 'lit'.
-
-unsigned Internal::walk_break_value (int lit) {
-
-  require_mode (WALK);
-  assert (val (lit) > 0);
-
-  unsigned res = 0;             // The computed break-count of 'lit'.
-
-  for (auto & w : watches (lit)) {
-    assert (w.blit != lit);
-    if (val (w.blit) > 0) continue;
-    if (w.binary ()) { res++; continue; }
-
-    Clause * c = w.clause;
-    assert (lit == c->literals[0]);
-
-    // Now try to find a second satisfied literal starting at 'literals[1]'
-    // shifting all the traversed literals to right by one position in order
-    // to move such a second satisfying literal to 'literals[1]'.  This move
-    // to front strategy improves the chances to find the second satisfying
-    // literal earlier in subsequent break-count computations.
-    //
-    auto begin = c->begin () + 1;
-    const auto end = c->end ();
-    auto i = begin;
-    int prev = 0;
-    while (i != end) {
-      const int other = *i;
-      *i++ = prev;
-      prev = other;
-      if (val (other) < 0) continue;
-
-      // Found 'other' as second satisfying literal.
-
-      w.blit = other;                   // Update 'blit'
-      *begin = other;                   // and move to front.
-
-      break;
-    }
-
-    if (i != end) continue;     // Double satisfied!
-
-    // Otherwise restore literals (undo shift to the right).
-    //
-    while (i != begin) {
-      const int other = *--i;
-      *i = prev;
-      prev = other;
-    }
-
-    res++;      // Literal 'lit' single satisfies clause 'c'.
-  }
-
+  unsigned res = walker.broken[pos];
+  LOG ("picking clause[%u] at random position %d", res, pos);
   return res;
 }
 
 /*------------------------------------------------------------------------*/
 
-// Given an unsatisfied clause 'c', in which we want to flip a literal, we
+// Given an unsatisfied clause 'i', in which we want to flip a literal, we
 // first determine the exponential score based on the break-count of its
 // literals and then sample the literals based on these scores.  The CB
 // value is smaller than one and thus the score is exponentially decreasing
@@ -183,20 +178,21 @@ unsigned Internal::walk_break_value (int lit) {
 // SAT solving we can not flip assumed variables.  Those are assigned at
 // decision level one, while the other variables are assigned at two.
 
-int Internal::walk_pick_lit (Walker & walker, Clause * c) {
+int Internal::walk_pick_lit (Walker & walker, unsigned c) {
   LOG ("picking literal by break-count");
   assert (walker.scores.empty ());
+  const int * const begin = walker.begin (c);
+  const int * const end = walker.end (c);
   double sum = 0;
-  int64_t propagations = 0;
-  for (const auto lit : *c) {
+  for (const int * p = begin; p != end; p++) {
+    const int lit = *p;
     assert (active (lit));
+    assert (val (lit) < 0);
     if (var (lit).level == 1) {
       LOG ("skipping assumption %d for scoring", -lit);
       continue;
     }
-    assert (active (lit));
-    propagations++;
-    unsigned tmp = walk_break_value (-lit);
+    unsigned tmp = walker.breaks[abs (lit)];
     double score = walker.score (tmp);
     LOG ("literal %d break-count %u score %g", lit, tmp, score);
     walker.scores.push_back (score);
@@ -204,13 +200,10 @@ int Internal::walk_pick_lit (Walker & walker, Clause * c) {
   }
   LOG ("scored %zd literals", walker.scores.size ());
   assert (!walker.scores.empty ());
-  walker.propagations += propagations;
-  stats.propagations.walk += propagations;
-  assert (walker.scores.size () <= (size_t) c->size);
+  assert (walker.scores.size () <= (size_t) (end - begin));
   const double lim = sum * walker.random.generate_double ();
   LOG ("score sum %g limit %g", sum, lim);
-  const auto end = c->end ();
-  auto i = c->begin ();
+  const int * i = begin;
   auto j = walker.scores.begin ();
   int res;
   for (;;) {
@@ -249,126 +242,73 @@ void Internal::walk_flip_lit (Walker & walker, int lit) {
   vals[-idx] = -tmp;
   assert (val (lit) > 0);
 
-  // Then remove 'c' and all other now satisfied (made) clauses.
+  // We measure (and bound) the memory accesses of traversing the
+  // occurrences of 'lit' and '-lit' in terms of 'propagations'.  As for
+  // watch lists during search we use the clause variable 'ratio' as
+  // approximation of the number of clauses touched while propagating one
+  // literal.  Thus a flip counts as one propagation plus the number of
+  // traversed occurrences divided by that ratio.  Only the counters of the
+  // clauses are touched but not their literals.
+  //
   {
-    // Simply go over all unsatisfied (broken) clauses.
-
-    LOG ("trying to make %zd broken clauses", walker.broken.size ());
-
-    // We need to measure (and bound) the memory accesses during traversing
-    // broken clauses in terms of 'propagations'. This is tricky since we
-    // are not actually propagating literals.  Instead we use the clause
-    // variable 'ratio' as an approximation to the number of clauses used
-    // during propagating a literal.  Note that we use a one-watch scheme.
-    // Accordingly the number of broken clauses traversed divided by that
-    // ratio is an approximation of the number of propagation this would
-    // correspond to (in terms of memory access).  To eagerly update these
-    // statistics we simply increment the propagation counter after every
-    // 'ratio' traversed clause.  These propagations are particularly
-    // expensive if the number of broken clauses is large which usually
-    // happens initially.
-    //
-    const double ratio = clause_variable_ratio ();
-    const auto eou = walker.broken.end ();
-    auto j = walker.broken.begin (), i = j;
-    int64_t made = 0, count = 0;
-
-    while (i != eou) {
-
-      Clause * d = *j++ = *i++;
-
-      int * literals = d->literals, prev = 0;
-
-      // Find 'lit' in 'd'.
-      //
-      const int size = d->size;
-      for (int i = 0; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev;
-        prev = other;
-        if (other == lit) break;
-        assert (val (other) < 0);
-      }
+    const unsigned pos = vlit (lit), neg = vlit (-lit);
+    const size_t traversed =
+      walker.offsets[pos + 1] - walker.offsets[pos] +
+      walker.offsets[neg + 1] - walker.offsets[neg];
+    const int64_t propagations = 1 + traversed / walker.ratio;
+    walker.propagations += propagations;
+    stats.propagations.walk += propagations;
+  }
 
-      // If 'lit' is in 'd' then move it to the front to watch it.
-      //
-      if (prev == lit) {
-        literals[0] = lit;
-        LOG (d, "made");
-        watch_literal (literals[0], literals[1], d);
+  // Clauses with 'lit' gain a true literal.  They are made if it is their
+  // first one and their previously critical literal is not critical any
+  // more if it is their second one.
+  {
+    const unsigned u = vlit (lit);
+    const size_t end = walker.offsets[u + 1];
+    int64_t made = 0;
+    for (size_t k = walker.offsets[u]; k != end; k++) {
+      const unsigned i = walker.occs[k];
+      const unsigned count = walker.counts[i]++;
+      if (!count) {
+        walker.pop_broken (i);
+        walker.breaks[idx]++;
         made++;
-        j--;
-
-      } else {  // Otherwise the clause is not satisfied, undo shift.
-
-        for (int i = size-1; i >= 0; i--) {
-          int other = literals[i];
-          literals[i] = prev;
-          prev = other;
-        }
+      } else if (count == 1) {
+        const int other = walker.criticals[i];
+        assert (val (other) > 0);
+        assert (walker.breaks[abs (other)]);
+        walker.breaks[abs (other)]--;
       }
-
-      if (count--) continue;
-
-      // Update these counters eagerly.  Otherwise if we delay the update
-      // until all clauses are traversed, interrupting the solver has a high
-      // chance of giving bogus statistics on the number of 'propagations'
-      // in 'walk', if it is interrupted in this loop.
-
-      count = ratio;                    // Starting counting down again.
-      walker.propagations++;
-      stats.propagations.walk++;
+      walker.criticals[i] ^= lit;
     }
     LOG ("made %" PRId64 " clauses by flipping %d", made, lit);
-    walker.broken.resize (j - walker.broken.begin ());
   }
 
-  // Finally add all new unsatisfied (broken) clauses.
+  // Clauses with '-lit' lose a true literal.  They become broken if it
+  // was their only one and the remaining true literal becomes critical
+  // if one is left.
   {
-    walker.propagations++;      // This really corresponds now to one
-    stats.propagations.walk++;  // propagation (in a one-watch scheme).
-
+    const unsigned u = vlit (-lit);
+    const size_t end = walker.offsets[u + 1];
     int64_t broken = 0;
-    Watches & ws = watches (-lit);
-
-    LOG ("trying to brake %zd watched clauses", ws.size ());
-
-    for (const auto & w : ws) {
-      Clause * d = w.clause;
-      LOG (d, "unwatch %d in", -lit);
-      int * literals = d->literals, replacement = 0, prev = -lit;
-      assert (literals[0] == -lit);
-      const int size = d->size;
-      for (int i = 1; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev;             // shift all to right
-        prev = other;
-        const signed char tmp = val (other);
-        if (tmp < 0) continue;
-        replacement = other;            // satisfying literal
-        break;
-      }
-      if (replacement) {
-        literals[1] = -lit;
-        literals[0] = replacement;
-        assert (-lit != replacement);
-        watch_literal (replacement, -lit, d);
-      } else {
-        for (int i = size-1; i > 0; i--) {      // undo shift
-          const int other = literals[i];
-          literals[i] = prev;
-          prev = other;
-        }
-        assert (literals[0] == -lit);
-        LOG (d, "broken");
-        walker.broken.push_back (d);
+    for (size_t k = walker.offsets[u]; k != end; k++) {
+      const unsigned i = walker.occs[k];
+      walker.criticals[i] ^= -lit;
+      assert (walker.counts[i]);
+      const unsigned count = --walker.counts[i];
+      if (!count) {
+        assert (walker.breaks[idx]);
+        walker.breaks[idx]--;
+        walker.push_broken (i);
         broken++;
+      } else if (count == 1) {
+        const int other = walker.criticals[i];
+        assert (val (other) > 0);
+        walker.breaks[abs (other)]++;
       }
     }
     LOG ("broken %" PRId64 " clauses by flipping %d", broken, lit);
-    ws.clear ();
   }
 }
 
@@ -401,8 +341,6 @@ int Internal::walk_round (int64_t limit, bool prev) {
 
   stats.walk.count++;
 
-  clear_watches ();
-
   // Remove all fixed variables first (assigned at decision level zero).
   //
   if (last.collect.fixed < stats.all.fixed)
@@ -497,64 +435,93 @@ int Internal::walk_round (int64_t limit, bool prev) {
       LOG ("initial assign %d to decision phase", tmp < 0 ? -idx : idx);
     }
 
-    LOG ("watching satisfied and registering broken clauses");
-#ifdef LOGGING
-    int64_t watched = 0;
-#endif
-    for (const auto c : clauses) {
+    // First copy the literals of the considered clauses into the flat
+    // clause store and connect them through occurrence lists in compressed
+    // sparse row format by first counting occurrences and then filling
+    // them in from the end of each range.
 
+    LOG ("copying and connecting considered clauses");
+    const size_t size_offsets = 2*vsize + 1;
+    walker.offsets.assign (size_offsets, 0);
+    walker.starts.push_back (0);
+    for (const auto c : clauses) {
       if (c->garbage) continue;
       if (c->redundant) {
         if (!opts.walkredundant) continue;
         if (!likely_to_be_kept_clause (c)) continue;
       }
+      for (const auto lit : *c) {
+        walker.literals.push_back (lit);
+        walker.offsets[vlit (lit)]++;
+      }
+      walker.starts.push_back (walker.literals.size ());
+    }
+    size_t occurrences = 0;
+    for (size_t u = 0; u < size_offsets; u++)
+      occurrences = (walker.offsets[u] += occurrences);
+    walker.occs.resize (occurrences);
+    const size_t size_clauses = walker.size_clauses ();
+    assert (size_clauses <= UINT_MAX);
+    for (size_t i = 0; i < size_clauses; i++)
+      for (const int * p = walker.begin (i); p != walker.end (i); p++)
+        walker.occs[--walker.offsets[vlit (*p)]] = i;
+
+    // Then count the true literals of each clause, register broken clauses
+    // and compute the initial break values.
+
+    LOG ("counting true literals and registering broken clauses");
+    walker.counts.resize (size_clauses);
+    walker.criticals.resize (size_clauses);
+    walker.positions.resize (size_clauses);
+    walker.breaks.assign (vsize, 0);
+#ifdef LOGGING
+    int64_t satisfied_clauses = 0;
+#endif
+    for (size_t i = 0; i < size_clauses; i++) {
 
       bool satisfiable = false;         // contains not only assumptions
-      int satisfied = 0;                // clause satisfied?
-
-      int * lits = c->literals;
-      const int size = c->size;
+      unsigned satisfied = 0;           // number of true literals
+      int critical = 0;                 // exclusive-or of true literals
 
-      // Move to front satisfied literals and determine whether there
-      // is at least one (non-assumed) literal that can be flipped.
-      //
-      for (int i = 0; satisfied < 2 && i < size; i++) {
-        const int lit = lits[i];
+      for (const int * p = walker.begin (i); p != walker.end (i); p++) {
+        const int lit = *p;
         assert (active (lit));  // Due to garbage collection.
         if (val (lit) > 0) {
-          swap (lits[satisfied], lits[i]);
-          if (!satisfied++) LOG ("first satisfying literal %d", lit);
+          satisfied++;
+          critical ^= lit;
         } else if (!satisfiable && var (lit).level > 1) {
           LOG ("non-assumption potentially satisfying literal %d", lit);
           satisfiable = true;
         }
       }
 
+      walker.counts[i] = satisfied;
+      walker.criticals[i] = critical;
+
       if (!satisfied && !satisfiable) {
-        LOG (c, "due to assumptions unsatisfiable");
+        LOG ("clause[%zd] due to assumptions unsatisfiable", i);
         LOG ("stopping local search since assumptions falsify a clause");
         failed = true;
         break;
       }
 
       if (satisfied) {
-        watch_literal (lits[0], lits[1], c);
+        if (satisfied == 1) walker.breaks[abs (critical)]++;
 #ifdef LOGGING
-        watched++;
+        satisfied_clauses++;
 #endif
       } else {
         assert (satisfiable);   // at least one non-assumed variable ...
-        LOG (c, "broken");
-        walker.broken.push_back (c);
+        walker.push_broken (i);
       }
     }
 #ifdef LOGGING
     if (!failed) {
       int64_t broken = walker.broken.size ();
-      int64_t total = watched + broken;
-      LOG ("watching %" PRId64 " clauses %.0f%% "
-           "out of %" PRId64 " (watched and broken)",
-        watched, percent (watched, total), total);
+      int64_t total = satisfied_clauses + broken;
+      LOG ("satisfied %" PRId64 " clauses %.0f%% "
+           "out of %" PRId64 " (satisfied and broken)",
+        satisfied_clauses, percent (satisfied_clauses, total), total);
     }
 #endif
   }
@@ -582,7 +549,7 @@ int Internal::walk_round (int64_t limit, bool prev) {
       flips++;
       stats.walk.flips++;
       stats.walk.broken += broken;
-      Clause * c = walk_pick_clause (walker);
+      const unsigned c = walk_pick_clause (walker);
       const int lit = walk_pick_lit (walker, c);
       walk_flip_lit (walker, lit);
       broken = walker.broken.size ();
@@ -641,8 +608,8 @@ int Internal::walk_round (int64_t limit, bool prev) {
   assert (level == 2);
   level = 0;
 
-  clear_watches ();
-  connect_watches ();
+  // Watches are not used (nor literals moved) during local search and thus
+  // do not have to be reconnected.
 
 #ifndef QUIET
   if (localsearching) {
@@ -0,0 +1,56 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+static void formula (CaDiCaL::Solver & solver) {
+  solver.add (1), solver.add (2), solver.add (0);
+  solver.add (1), solver.add (-2), solver.add (0);
+  solver.add (3), solver.add (4), solver.add (0);
+}
+int main () {
+  vector<int> lits;
+  {
+    // Without limits '1' is the only backbone literal.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    formula (solver);
+    int res = solver.backbone (lits);
+    cout << "backbone without limit = " << res << endl;
+    assert (res == 10);
+    assert (lits.size () == 1 && lits[0] == 1);
+  }
+  {
+    // Group variables are not part of the backbone.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    formula (solver);
+    const int group = solver.open_group ();
+    solver.add (6), solver.add (7), solver.add (0);
+    solver.close_group ();
+    int res = solver.backbone (lits);
+    cout << "backbone with group = " << res << endl;
+    assert (res == 10);
+    for (auto lit : lits) assert (abs (lit) != group);
+    assert (lits.size () == 1 && lits[0] == 1);
+  }
+  {
+    // The conflict limit applies to all internal calls.  The first call
+    // is satisfied by lucky phases, but refuting '-1' needs a conflict.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    formula (solver);
+    solver.limit ("conflicts", 0);
+    int res = solver.backbone (lits);
+    cout << "backbone with conflict limit = " << res << endl;
+    assert (!res);
+    assert (lits.empty ());
+    res = solver.backbone (lits);
+    cout << "backbone after reset limits = " << res << endl;
+    assert (res == 10);
+  }
+  return 0;
+}
@@ -0,0 +1,117 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Check that the bulk functions 'add_clause', 'add_clauses', 'assume_all'
+// and 'vals' give the same results as 'add', 'assume' and 'val'.
+
+static unsigned state = 42;
+
+static int pick (int n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+
+static const int vars = 40;
+
+static void random_formula (vector<int> & flat, int clauses) {
+  for (int i = 0; i < clauses; i++) {
+    for (int j = 0; j < 3; j++) {
+      int lit = 1 + pick (vars);
+      if (pick (2)) lit = -lit;
+      flat.push_back (lit);
+    }
+    flat.push_back (0);
+  }
+}
+
+int main () {
+
+  for (int round = 0; round < 20; round++) {
+
+    vector<int> flat;
+    random_formula (flat, 120 + 3*round);
+
+    CaDiCaL::Solver single, clause, clauses;
+
+    for (auto lit : flat)
+      single.add (lit);
+
+    for (size_t i = 0, j = 0; j < flat.size (); j++)
+      if (!flat[j]) clause.add_clause (&flat[i], j - i), i = j + 1;
+
+    clauses.add_clauses (flat.data (), 0);      // empty buffer
+    clauses.add_clauses (flat.data (), flat.size ());
+
+    for (int call = 0; call < 4; call++) {
+
+      vector<int> assumptions;
+      for (int i = 0; i < call; i++) {
+        int lit = 1 + pick (vars);
+        if (pick (2)) lit = -lit;
+        assumptions.push_back (lit);
+      }
+
+      for (auto lit : assumptions) single.assume (lit);
+      clause.assume_all (assumptions.data (), assumptions.size ());
+      clauses.assume_all (assumptions.data (), assumptions.size ());
+
+      const int res = single.solve ();
+      assert (res == 10 || res == 20);
+      assert (clause.solve () == res);
+      assert (clauses.solve () == res);
+
+      cout << "round " << round << " call " << call
+           << " result " << res << endl;
+
+      if (res != 10) continue;
+
+      vector<int> lits;
+      for (int idx = 1; idx <= vars; idx++)
+        lits.push_back (idx), lits.push_back (-idx);
+
+      vector<int> values (lits.size ());
+      clauses.vals (lits.data (), values.data (), lits.size ());
+      for (size_t i = 0; i < lits.size (); i++)
+        assert (values[i] == clauses.val (lits[i]));
+
+      for (size_t i = 0, j = 0; j < flat.size (); j++) {
+        if (flat[j]) continue;
+        bool satisfied = false;
+        for (size_t k = i; !satisfied && k < j; k++)
+          satisfied = (clauses.val (flat[k]) > 0);
+        assert (satisfied);
+        i = j + 1;
+      }
+      for (auto lit : assumptions)
+        assert (clauses.val (lit) > 0);
+    }
+  }
+
+  // Consecutive zeros in the buffer denote an empty clause.
+  {
+    CaDiCaL::Solver single, clauses;
+    const int flat[] = { 1, 2, 0, 0 };
+    for (auto lit : flat) single.add (lit);
+    clauses.add_clauses (flat, 4);
+    assert (single.solve () == 20);
+    assert (clauses.solve () == 20);
+  }
+
+  // An empty 'add_clause' adds the empty clause.
+  {
+    CaDiCaL::Solver solver;
+    solver.add_clause (0, 0);
+    assert (solver.solve () == 20);
+  }
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Pigeon hole formulas with 'card=1', which are refuted by cardinality
+// reasoning, while the formulas with as many holes as pigeons are
+// satisfiable.  Since cardinality reasoning is disabled when checking
+// proofs, only models and failed assumptions are checked internally.
+static int var (int holes, int pigeon, int hole) {
+  return pigeon * holes + hole + 1;
+}
+static int php (int pigeons, int holes, bool assume) {
+  CaDiCaL::Solver solver;
+  solver.set ("card", 1);
+  solver.set ("check", 1);
+  solver.set ("checkproof", 0);
+  vector<vector<int>> clauses;
+  for (int p = 0; p < pigeons; p++) {
+    vector<int> c;
+    for (int h = 0; h < holes; h++) c.push_back (var (holes, p, h));
+    clauses.push_back (c);
+  }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p < pigeons; p++)
+      for (int q = p + 1; q < pigeons; q++)
+        clauses.push_back ({ -var (holes, p, h), -var (holes, q, h) });
+  for (const auto & c : clauses) {
+    for (auto lit : c) solver.add (lit);
+    solver.add (0);
+  }
+  if (assume) solver.assume (var (holes, 0, 0));
+  const int res = solver.solve ();
+  if (res == 10) {
+    for (const auto & c : clauses) {
+      bool satisfied = false;
+      for (auto lit : c) if (solver.val (lit) > 0) satisfied = true;
+      assert (satisfied);
+    }
+    if (assume) assert (solver.val (var (holes, 0, 0)) > 0);
+  }
+  return res;
+}
+int main () {
+  for (int assume = 0; assume < 2; assume++) {
+    // Checking failed assumptions refutes the formula without cardinality
+    // reasoning, thus only small formulas are solved under assumptions.
+    const int max_holes = assume ? 7 : 9;
+    for (int holes = 2; holes <= max_holes; holes++) {
+      int res = php (holes + 1, holes, assume);
+      cout << "php (" << holes + 1 << ", " << holes << ") = "
+           << res << endl;
+      assert (res == 20);
+      res = php (holes, holes, assume);
+      cout << "php (" << holes << ", " << holes << ") = "
+           << res << endl;
+      assert (res == 10);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,38 @@
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+// Same formula as in 'ctest.c' but added and queried through the bulk
+// functions of the C API.
+
+int main () {
+  CCaDiCaL * solver = ccadical_init ();
+  const int clauses[] = { -1, 2, 0, 1, 2, 0 };
+  ccadical_add_clauses (solver, clauses, 6);
+  const int clause[] = { -1, -2 };
+  ccadical_add_clause (solver, clause, 2);
+  const int assumptions[] = { 2 };
+  ccadical_assume_all (solver, assumptions, 1);
+  int res = ccadical_solve (solver);
+  assert (res == 10);
+  const int lits[] = { 1, -1, 2, -2 };
+  int values[4];
+  ccadical_vals (solver, lits, values, 4);
+  assert (values[0] == -1);
+  assert (values[1] == 1);
+  assert (values[2] == 2);
+  assert (values[3] == -2);
+  assert (values[0] == ccadical_val (solver, 1));
+  assert (values[2] == ccadical_val (solver, 2));
+  const int failing[] = { 1, 2 };
+  ccadical_assume_all (solver, failing, 2);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  assert (ccadical_failed (solver, 1) || ccadical_failed (solver, 2));
+  ccadical_release (solver);
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// The failed assumptions minimized with 'coremin' still form a core, i.e.,
+// solving under only the failed assumptions is unsatisfiable again.
+static unsigned state = 1;
+static int pick (int n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+static const int vars = 50;
+static void formula (CaDiCaL::Solver & solver) {
+  state = 1;
+  for (int i = 0; i < 160; i++) {
+    for (int j = 0; j < 3; j++) {
+      const int lit = 1 + pick (vars);
+      solver.add (pick (2) ? lit : -lit);
+    }
+    solver.add (0);
+  }
+}
+int main () {
+  for (int coremin = 1; coremin <= 2; coremin++) {
+    CaDiCaL::Solver solver, checker;
+    solver.set ("check", 1);
+    solver.set ("coremin", coremin);
+    solver.set ("chronoalways", 1);
+    formula (solver);
+    formula (checker);
+    int unsat = 0;
+    for (int call = 0; call < 100; call++) {
+      vector<int> assumptions;
+      const int size = 3 + pick (15);
+      for (int j = 0; j < size; j++) {
+        const int lit = 1 + pick (vars);
+        assumptions.push_back (pick (2) ? lit : -lit);
+      }
+      for (auto lit : assumptions) solver.assume (lit);
+      int res = solver.solve ();
+      if (res == 10) continue;
+      assert (res == 20);
+      unsat++;
+      vector<int> core;
+      for (auto lit : assumptions)
+        if (solver.failed (lit)) core.push_back (lit);
+      assert (!core.empty ());
+      for (auto lit : core) checker.assume (lit);
+      res = checker.solve ();
+      assert (res == 20);
+    }
+    cout << "coremin=" << coremin << ": "
+         << unsat << " unsatisfiable calls" << endl;
+    assert (unsat);
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Random systems of XOR constraints (in CNF) solved with 'gauss=1' and
+// compared against a solver without Gaussian elimination.  Since Gaussian
+// elimination is disabled when checking proofs, only models and failed
+// assumptions are checked internally (and models here too).
+static unsigned state = 1;
+static int pick (int n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+static const int vars = 60;
+static vector<vector<int>> clauses;
+static void add_xor (CaDiCaL::Solver & a, CaDiCaL::Solver & b,
+                     int x, int y, int z, int parity) {
+  for (int signs = 0; signs < 8; signs++) {
+    int negative = 0;
+    for (int k = 0; k < 3; k++)
+      if (signs & (1 << k)) negative++;
+    // Exclude the assignment falsifying all literals of the clause.
+    if ((negative & 1) == parity) continue;
+    vector<int> c {
+      signs & 1 ? -x : x, signs & 2 ? -y : y, signs & 4 ? -z : z };
+    for (auto lit : c) a.add (lit), b.add (lit);
+    a.add (0), b.add (0);
+    clauses.push_back (c);
+  }
+}
+int main () {
+  int sat = 0, unsat = 0;
+  for (int round = 0; round < 20; round++) {
+    CaDiCaL::Solver solver, reference;
+    solver.set ("gauss", 1);
+    solver.set ("check", 1);
+    solver.set ("checkproof", 0);
+    clauses.clear ();
+    const int xors = vars - 10 + pick (20);
+    for (int i = 0; i < xors; i++) {
+      int x = 1 + pick (vars), y, z;
+      do y = 1 + pick (vars); while (y == x);
+      do z = 1 + pick (vars); while (z == x || z == y);
+      add_xor (solver, reference, x, y, z, pick (2));
+    }
+    for (int call = 0; call < 5; call++) {
+      vector<int> assumptions;
+      const int size = pick (3);
+      for (int j = 0; j < size; j++) {
+        const int lit = 1 + pick (vars);
+        assumptions.push_back (pick (2) ? lit : -lit);
+      }
+      for (auto lit : assumptions)
+        solver.assume (lit), reference.assume (lit);
+      const int res = solver.solve ();
+      assert (res == reference.solve ());
+      if (res == 10) {
+        sat++;
+        for (auto lit : assumptions) assert (solver.val (lit) > 0);
+        for (const auto & c : clauses) {
+          bool satisfied = false;
+          for (auto lit : c)
+            if (solver.val (lit) > 0) satisfied = true;
+          assert (satisfied);
+        }
+      } else {
+        assert (res == 20);
+        unsat++;
+      }
+    }
+  }
+  cout << sat << " satisfiable and " << unsat
+       << " unsatisfiable calls" << endl;
+  assert (sat && unsat);
+  return 0;
+}
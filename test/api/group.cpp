@@ -0,0 +1,36 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+int main () {
+  CaDiCaL::Solver solver;
+  solver.set ("check", 1);
+  solver.add (1), solver.add (2), solver.add (0);
+  assert (solver.vars () == 2);
+  int g = solver.open_group ();
+  cout << "solver.open_group () = " << g << endl;
+  assert (g == 3);
+  assert (solver.vars () == 3);
+  solver.add (-1), solver.add (0);
+  solver.add (-2), solver.add (0);
+  solver.close_group ();
+  int res = solver.solve ();
+  cout << "solver.solve () = " << res << endl;
+  assert (res == 20);
+  assert (solver.failed (g));
+  solver.retract_group (g);
+  // The next fresh user variable is above the group variable.
+  const int fresh = solver.vars () + 1;
+  assert (fresh == 4);
+  solver.add (-1), solver.add (fresh), solver.add (0);
+  solver.assume (-2);
+  res = solver.solve ();
+  cout << "solver.solve () = " << res << endl;
+  assert (res == 10);
+  assert (solver.val (1) > 0);
+  assert (solver.val (fresh) > 0);
+  return 0;
+}
@@ -0,0 +1,102 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Variables added by bounded variable addition are hidden from the user.
+// They are not counted by 'vars', their indices are treated as unused by
+// 'val', 'fixed' and 'failed', and in traversed clauses they only show up
+// with indices above all user variables (even if the user used larger
+// indices after they were added).
+
+static const int n = 10;
+
+struct Collector : ClauseIterator {
+  vector<vector<int>> clauses;
+  bool clause (const vector<int> & c) {
+    clauses.push_back (c);
+    return true;
+  }
+};
+
+int main () {
+
+  Solver solver;
+  solver.set ("check", 1);
+  solver.set ("checkproof", 0);      // Otherwise 'bva' is disabled.
+
+  // Pairwise at-most-one constraint, which 'bva' turns into a product
+  // like encoding with new hidden variables.
+
+  for (int i = 1; i <= n; i++)
+    for (int j = i + 1; j <= n; j++)
+      solver.add (-i), solver.add (-j), solver.add (0);
+  for (int i = 1; i <= n; i++) solver.add (i), solver.freeze (i);
+  solver.add (0);
+
+  int res = solver.simplify (1);
+  assert (!res);
+  assert (solver.vars () == n);
+
+  // A larger user variable makes the hidden variables look like user
+  // variables unless they are relocated during traversal.
+
+  const int user = 3 * n;
+  solver.add (user), solver.add (0);
+  assert (solver.vars () == user);
+
+  Collector collector;
+  solver.traverse_clauses (collector);
+  const size_t pairwise = n * (n - 1) / 2;
+  cout << collector.clauses.size () << " clauses traversed instead of "
+       << pairwise + 2 << endl;
+  assert (collector.clauses.size () < pairwise + 2);
+  int hidden = 0;
+  for (const auto & c : collector.clauses)
+    for (auto lit : c) {
+      const int idx = abs (lit);
+      if (idx > user) hidden++;
+      else assert (idx <= n || idx == user);
+    }
+  cout << hidden << " occurrences of hidden variables" << endl;
+  assert (hidden);
+
+  for (int idx = n + 1; idx < user; idx++)
+    assert (!solver.fixed (idx)), assert (!solver.fixed (-idx));
+
+  res = solver.solve ();
+  assert (res == 10);
+  int count = 0;
+  for (int idx = 1; idx <= n; idx++)
+    if (solver.val (idx) > 0) count++;
+  assert (count == 1);
+  for (int idx = user + 1; idx < 4 * user; idx++) {
+    assert (solver.val (idx) < 0);
+    assert (solver.val (-idx) > 0);
+  }
+
+  // Using a hidden index as user variable relocates the hidden variable.
+
+  for (int idx = user + 1; idx <= user + 3; idx++)
+    solver.add (idx), solver.add (0);
+  assert (solver.vars () == user + 3);
+  res = solver.solve ();
+  assert (res == 10);
+  for (int idx = user + 1; idx <= user + 3; idx++)
+    assert (solver.val (idx) > 0);
+  solver.assume (1), solver.assume (2);
+  res = solver.solve ();
+  assert (res == 20);
+  for (int idx = user + 4; idx < 4 * user; idx++)
+    assert (!solver.failed (idx)), assert (!solver.failed (-idx));
+
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstring>
+using namespace std;
+static void formula (CaDiCaL::Solver & solver, int n) {
+  for (int i = 1; i < n; i++)
+    solver.add (-i), solver.add (i + 1), solver.add (0);
+}
+int main () {
+  CaDiCaL::Solver solver;
+  formula (solver, 1000);
+  int res = solver.solve ();
+  assert (res == 10);
+  const char * names [] = {
+    "arena", "clauses", "watches", "occs", "big", "pool",
+    "extension", "checker", "proof", "total",
+  };
+  int64_t sum = 0;
+  for (auto name : names) {
+    int64_t bytes = solver.memory (name);
+    cout << "solver.memory (\"" << name << "\") = " << bytes << endl;
+    assert (bytes >= 0);
+    if (strcmp (name, "total")) sum += bytes;
+    else assert (bytes == sum);
+  }
+  assert (solver.memory ("watches") > 0);
+  assert (solver.memory ("invalid") < 0);
+  assert (solver.is_valid_limit ("memory"));
+  assert (solver.limit ("memory", 1 << 20));
+  res = solver.solve ();
+  assert (res == 10);
+  return 0;
+}
@@ -0,0 +1,210 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// External propagator enforcing that exactly one of the variables '1' to
+// 'n' is true.  'At most one' is enforced eagerly by propagating the other
+// variables to false (with binary reason clauses), which yields conflicts
+// if two of them are already true.  'At least one' is only enforced lazily
+// by rejecting models and adding the clause '1 ... n' as external clause.
+// Additionally the clause '-n n+1' is added as external clause initially.
+
+static const int n = 8;
+
+class ExactlyOne : public ExternalPropagator {
+
+  vector<signed char> values;           // Notified assignment.
+  vector<vector<int>> levels;           // Notified literals per level.
+  vector<int> pending;                  // External clause to add.
+  vector<int> reason;                   // Reason clause to add.
+  bool initial;                         // Initial clause not added yet.
+
+public:
+
+  int propagated, conflicts, rejected, notified;
+
+  ExactlyOne () :
+    values (n + 2, 0), levels (1), initial (true),
+    propagated (0), conflicts (0), rejected (0), notified (0)
+  { }
+
+  int value (int lit) const {
+    const int tmp = values[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  }
+
+  void notify_assignment (int lit, bool is_fixed) {
+    assert (0 < abs (lit) && abs (lit) <= n + 1);
+    values[abs (lit)] = lit < 0 ? -1 : 1;
+    if (is_fixed) levels[0].push_back (lit);
+    else levels.back ().push_back (lit);
+    notified++;
+  }
+
+  void notify_new_decision_level () { levels.push_back (vector<int> ()); }
+
+  void notify_backtrack (size_t new_level) {
+    assert (new_level < levels.size ());
+    while (levels.size () > new_level + 1) {
+      for (auto lit : levels.back ()) values[abs (lit)] = 0;
+      levels.pop_back ();
+    }
+  }
+
+  bool cb_check_found_model (const vector<int> & model) {
+    assert (model.size () == (size_t) n + 1);
+    for (auto lit : model) assert (value (lit) > 0);
+    for (int idx = 1; idx <= n; idx++)
+      if (value (idx) > 0) return true;
+    rejected++;
+    for (int idx = 1; idx <= n; idx++) pending.push_back (idx);
+    return false;
+  }
+
+  int cb_propagate () {
+    int first = 0;
+    for (int idx = 1; !first && idx <= n; idx++)
+      if (value (idx) > 0) first = idx;
+    if (!first) return 0;
+    for (int idx = 1; idx <= n; idx++) {
+      if (idx == first || value (idx) < 0) continue;
+      if (value (idx) > 0) conflicts++;
+      propagated++;
+      reason.clear ();
+      reason.push_back (0);
+      reason.push_back (-first);
+      reason.push_back (-idx);
+      return -idx;
+    }
+    return 0;
+  }
+
+  int cb_add_reason_clause_lit (int lit) {
+    (void) lit;
+    assert (!reason.empty ());
+    const int res = reason.back ();
+    reason.pop_back ();
+    return res;
+  }
+
+  bool cb_has_external_clause () {
+    if (initial) {
+      initial = false;
+      pending.push_back (n + 1);
+      pending.push_back (-n);
+    }
+    return !pending.empty ();
+  }
+
+  int cb_add_external_clause_lit () {
+    if (pending.empty ()) return 0;
+    const int res = pending.back ();
+    pending.pop_back ();
+    return res;
+  }
+};
+
+static unsigned state = 1;
+
+static int pick (int m) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % m;
+}
+
+static const int vars = 40;
+
+static void add (Solver & a, Solver & b, vector<int> clause) {
+  for (auto lit : clause) a.add (lit), b.add (lit);
+  a.add (0), b.add (0);
+}
+
+int main () {
+
+  Solver solver, reference;
+  solver.set ("check", 1);
+
+  ExactlyOne propagator;
+  solver.connect_external_propagator (&propagator);
+  for (int idx = 1; idx <= n + 1; idx++)
+    solver.add_observed_var (idx);
+  for (int idx = 1; idx <= n; idx++)
+    solver.phase (-idx);
+
+  // Eager encoding of the propagator in the reference solver.
+
+  for (int i = 1; i <= n; i++)
+    for (int j = i + 1; j <= n; j++)
+      reference.add (-i), reference.add (-j), reference.add (0);
+  for (int idx = 1; idx <= n; idx++) reference.add (idx);
+  reference.add (0);
+  reference.add (-n), reference.add (n + 1), reference.add (0);
+
+  // Variables forcing two of the first 'n' variables at once by unit
+  // propagation, which leads to conflicts in external propagation.
+
+  for (int i = 1; i < n; i++) {
+    const int other = n + 1 + i;
+    vector<int> first { -other, i }, second { -other, i + 1 };
+    add (solver, reference, first);
+    add (solver, reference, second);
+  }
+
+  int sat = 0, unsat = 0;
+  for (int call = 0; call < 100; call++) {
+    if (!pick (3)) {
+      vector<int> clause;
+      for (int j = 0; j < 3; j++) {
+        const int lit = n + 2 + pick (vars - n - 1);
+        clause.push_back (pick (2) ? lit : -lit);
+      }
+      add (solver, reference, clause);
+    }
+    vector<int> assumptions;
+    const int size = pick (4);
+    for (int j = 0; j < size; j++) {
+      const int lit = 1 + pick (vars);
+      assumptions.push_back (pick (3) ? -lit : lit);
+    }
+    for (auto lit : assumptions) solver.assume (lit), reference.assume (lit);
+    const int res = solver.solve ();
+    assert (res == reference.solve ());
+    if (res == 10) {
+      sat++;
+      int count = 0;
+      for (int idx = 1; idx <= n; idx++)
+        if (solver.val (idx) > 0) count++;
+      assert (count == 1);
+      assert (solver.val (-n) > 0 || solver.val (n + 1) > 0);
+      for (auto lit : assumptions) assert (solver.val (lit) > 0);
+    } else {
+      assert (res == 20);
+      unsat++;
+    }
+  }
+
+  cout << sat << " satisfiable and " << unsat
+       << " unsatisfiable calls" << endl;
+  cout << propagator.notified << " notified, "
+       << propagator.propagated << " propagated, "
+       << propagator.conflicts << " conflicts and "
+       << propagator.rejected << " rejected" << endl;
+
+  assert (sat && unsat);
+  assert (propagator.notified);
+  assert (propagator.propagated);
+  assert (propagator.conflicts);
+  assert (propagator.rejected);
+
+  solver.disconnect_external_propagator ();
+
+  return 0;
+}
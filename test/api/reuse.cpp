@@ -0,0 +1,84 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Incremental solving with assumptions sharing a prefix with those of the
+// previous call and then diverging, which lets 'solve' reuse assumption
+// levels of the trail.  Results are compared against a solver which does
+// not reuse the trail ('assumereusetrail=0').
+static unsigned state = 1;
+static int pick (int n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+static const int vars = 60;
+static vector<vector<int>> clauses;
+static void add (CaDiCaL::Solver * solvers[2], const vector<int> & c) {
+  for (int i = 0; i < 2; i++) {
+    for (auto lit : c) solvers[i]->add (lit);
+    solvers[i]->add (0);
+  }
+  clauses.push_back (c);
+}
+static vector<int> random_clause () {
+  vector<int> c;
+  for (int j = 0; j < 3; j++) {
+    const int lit = 1 + pick (vars);
+    c.push_back (pick (2) ? lit : -lit);
+  }
+  return c;
+}
+int main () {
+  CaDiCaL::Solver a, b;
+  CaDiCaL::Solver * solvers[2] = { &a, &b };
+  a.set ("check", 1);
+  b.set ("check", 1);
+  a.set ("assumereusetrail", 1);
+  b.set ("assumereusetrail", 0);
+  for (int i = 0; i < 150; i++) add (solvers, random_clause ());
+  vector<int> prefix;
+  int sat = 0, unsat = 0;
+  for (int call = 0; call < 200; call++) {
+    // Keep a random part of the previous assumptions and extend it.
+    prefix.resize (pick (prefix.size () + 1));
+    const int extend = 1 + pick (4);
+    for (int j = 0; j < extend; j++) {
+      const int lit = 1 + pick (vars);
+      prefix.push_back (pick (2) ? lit : -lit);
+    }
+    if (!pick (20)) add (solvers, random_clause ());
+    int res[2];
+    for (int i = 0; i < 2; i++) {
+      for (auto lit : prefix) solvers[i]->assume (lit);
+      res[i] = solvers[i]->solve ();
+    }
+    assert (res[0] == res[1]);
+    if (res[0] == 10) {
+      sat++;
+      for (auto lit : prefix) assert (a.val (lit) > 0);
+      for (const auto & c : clauses) {
+        bool satisfied = false;
+        for (auto lit : c) if (a.val (lit) > 0) satisfied = true;
+        assert (satisfied);
+      }
+    } else {
+      assert (res[0] == 20);
+      unsat++;
+      vector<int> core;
+      for (auto lit : prefix) if (a.failed (lit)) core.push_back (lit);
+      assert (!core.empty ());
+      for (auto lit : core) b.assume (lit);
+      res[1] = b.solve ();
+      assert (res[1] == 20);
+    }
+  }
+  cout << sat << " satisfiable and " << unsat
+       << " unsatisfiable calls" << endl;
+  assert (sat && unsat);
+  assert (a.solve () == 10);
+  return 0;
+}
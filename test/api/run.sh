@@ -110,6 +110,17 @@ run learn
 run cfreeze
 run traverse
 run cipasir
+run bulk
+run cbulk
+run group
+run reuse
+run coremin
+run propagator
+run gauss
+run card
+run hidden
+run backbone
+run memory
 
 [ "`grep DNTRACING $makefile`" = "" ] && run apitrace
 